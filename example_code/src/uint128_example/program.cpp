@@ -609,6 +609,8 @@ void cjm::uint128::example_code::say_hello()
 	cout << "Intel Adx Available: [" << std::boolalpha << intel_adx_available << "]." << newl;
 	cout << "Intel BMI2 Available: [" << std::boolalpha << intel_bmi2_available << "]." << newl;
 	cout << "Sse3 available: [" << std::boolalpha << sse3_available << "]." << newl;
+	cout << "Ssse3 available: [" << std::boolalpha << ssse3_available << "]." << newl;
+	cout << "Avx2 available: [" << std::boolalpha << avx2_available << "]." << newl;
 	cout << "Consteval available: [" << std::boolalpha << cjm::numerics::internal::has_consteval << "]." << newl;
 }
 
@@ -0,0 +1,164 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_ATOMIC_UINT128_HPP_
+#define CJM_ATOMIC_UINT128_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#if defined(CJM_MSVC_CMPXCHG16B_AVAILABLE)
+#include <intrin.h>
+#endif
+
+namespace cjm::numerics
+{
+	/************************************************************************/
+	/* A lock-free atomic uint128.  libstdc++'s std::atomic<uint128> calls
+	 * into libatomic, which takes a lock; this uses the hardware's 16-byte
+	 * compare and swap instead:
+	 *	- x86-64 (gcc and clang): lock cmpxchg16b via inline assembly, so
+	 *	  -mcx16 is not required.  Every x64 processor except the very
+	 *	  earliest AMD64 parts has it; 64-bit Windows 8.1+ requires it.
+	 *	- x64 (msvc): _InterlockedCompareExchange128.
+	 *	- AArch64 (gcc and clang): the __atomic builtins on unsigned
+	 *	  __int128, which become casp where LSE is available (or is
+	 *	  detected at runtime via outline atomics) and ldxp/stxp loops
+	 *	  otherwise.
+	 *	- Anywhere else: a spinlock embedded in the object.
+	 *	  is_always_lock_free is false.
+	 *
+	 * On x86-64 every operation is a locked instruction and hence
+	 * sequentially consistent whatever memory_order is asked for.
+	 *
+	 * Restriction on load() with cmpxchg16b (x86-64, gcc, clang and msvc):
+	 * there is no 16-byte atomic load, so load() and operator uint128() are
+	 * a lock cmpxchg16b that writes the unchanged value back, through a
+	 * mutable member, even on a const atomic_uint128.  Consequently:
+	 *	- const does not mean read-only here.  The object must live in
+	 *	  writable memory: loading from a page mapped read-only (e.g. a
+	 *	  PROT_READ mapping or read-only shared memory) faults.  The
+	 *	  mutable member keeps the compiler itself from placing even a
+	 *	  const, constant-initialized atomic_uint128 in a read-only section.
+	 *	- every load takes the cache line exclusive, so threads that only
+	 *	  read still contend with each other like writers do.  For data
+	 *	  that is read far more often than written, publish an immutable
+	 *	  value behind a pointer instead.
+	 * load() stays const so that the class keeps std::atomic's interface.
+	 * AArch64 and the spinlock fallback have no such restriction.
+	 *
+	 * std::atomic<uint128> is specialized below in terms of this class.
+	 * Include this header in every translation unit that uses
+	 * std::atomic<uint128> so they all see the same specialization.
+	 *																		*/
+	/************************************************************************/
+	class alignas(alignof(std::uint64_t) * 2) atomic_uint128
+	{
+	public:
+		using value_type = uint128;
+		using difference_type = uint128;
+
+		static constexpr bool is_always_lock_free =
+#if defined(CJM_GNU_X64_ASM_CMPXCHG16B_AVAILABLE) || defined(CJM_MSVC_CMPXCHG16B_AVAILABLE) || defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+			true;
+#else
+			false;
+#endif
+
+		constexpr atomic_uint128() noexcept;
+		constexpr atomic_uint128(uint128 desired) noexcept; //NOLINT (implicit like std::atomic)
+		atomic_uint128(const atomic_uint128& other) = delete;
+		atomic_uint128& operator=(const atomic_uint128& other) = delete;
+		~atomic_uint128() = default;
+
+		[[nodiscard]] bool is_lock_free() const noexcept;
+
+		void store(uint128 desired, std::memory_order order = std::memory_order_seq_cst) noexcept;
+		/// <summary>
+		/// Read the value.  With cmpxchg16b this is a locked compare and swap that writes the value back:
+		/// although const, it requires writable memory and exclusive ownership of the cache line.
+		/// </summary>
+		[[nodiscard]] uint128 load(std::memory_order order = std::memory_order_seq_cst) const noexcept;
+		operator uint128() const noexcept; //NOLINT (implicit like std::atomic; same restriction as load)
+		uint128 operator=(uint128 desired) noexcept; //NOLINT (returns value like std::atomic)
+		uint128 exchange(uint128 desired, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+		/// <summary>
+		/// If the stored value equals expected, replaces it with desired and returns true; otherwise
+		/// loads the stored value into expected and returns false.  The weak and strong forms are
+		/// identical on x86-64 and with casp; the weak form may fail spuriously with ldxp/stxp.
+		/// As with std::atomic, failure may not be memory_order_release or memory_order_acq_rel (asserted).
+		/// </summary>
+		bool compare_exchange_weak(uint128& expected, uint128 desired, std::memory_order success,
+			std::memory_order failure) noexcept;
+		bool compare_exchange_weak(uint128& expected, uint128 desired,
+			std::memory_order order = std::memory_order_seq_cst) noexcept;
+		bool compare_exchange_strong(uint128& expected, uint128 desired, std::memory_order success,
+			std::memory_order failure) noexcept;
+		bool compare_exchange_strong(uint128& expected, uint128 desired,
+			std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+		/// <summary>
+		/// Each fetch_ operation is a compare-and-swap loop (there is no 16-byte xadd) and returns
+		/// the value held immediately before the update.  Arithmetic wraps, as it does for uint128.
+		/// </summary>
+		uint128 fetch_add(uint128 operand, std::memory_order order = std::memory_order_seq_cst) noexcept;
+		uint128 fetch_sub(uint128 operand, std::memory_order order = std::memory_order_seq_cst) noexcept;
+		uint128 fetch_and(uint128 operand, std::memory_order order = std::memory_order_seq_cst) noexcept;
+		uint128 fetch_or(uint128 operand, std::memory_order order = std::memory_order_seq_cst) noexcept;
+		uint128 fetch_xor(uint128 operand, std::memory_order order = std::memory_order_seq_cst) noexcept;
+
+		uint128 operator++() noexcept;
+		uint128 operator++(int) noexcept;
+		uint128 operator--() noexcept;
+		uint128 operator--(int) noexcept;
+		uint128 operator+=(uint128 operand) noexcept;
+		uint128 operator-=(uint128 operand) noexcept;
+		uint128 operator&=(uint128 operand) noexcept;
+		uint128 operator|=(uint128 operand) noexcept;
+		uint128 operator^=(uint128 operand) noexcept;
+
+	private:
+		bool compare_exchange(uint128& expected, uint128 desired, std::memory_order success,
+			std::memory_order failure) const noexcept;
+		[[nodiscard]] uint128 peek() const noexcept;
+		template<typename Op>
+		uint128 fetch_update(Op op, std::memory_order order) noexcept;
+
+#if defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+		mutable unsigned __int128 m_value;
+#else
+		mutable uint128 m_value;
+#endif
+#if !defined(CJM_GNU_X64_ASM_CMPXCHG16B_AVAILABLE) && !defined(CJM_MSVC_CMPXCHG16B_AVAILABLE) && !defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+		mutable std::atomic_flag m_lock;
+#endif
+	};
+}
+
+namespace std
+{
+	template<>
+	struct atomic<cjm::numerics::uint128> final : cjm::numerics::atomic_uint128
+	{
+		using cjm::numerics::atomic_uint128::atomic_uint128;
+		using cjm::numerics::atomic_uint128::operator=;
+	};
+}
+#include <cjm/numerics/atomic_uint128.inl>
+#endif
@@ -0,0 +1,312 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_ATOMIC_UINT128_INL_
+#define CJM_ATOMIC_UINT128_INL_
+#include <cjm/numerics/atomic_uint128.hpp>
+
+namespace cjm::numerics
+{
+	namespace internal
+	{
+#if defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+		constexpr unsigned __int128 to_native_u128(uint128 value) noexcept
+		{
+			return (static_cast<unsigned __int128>(value.high_part()) << 64) | value.low_part();
+		}
+
+		constexpr uint128 from_native_u128(unsigned __int128 value) noexcept
+		{
+			return uint128::make_uint128(static_cast<std::uint64_t>(value >> 64), static_cast<std::uint64_t>(value));
+		}
+
+		constexpr int to_gnu_memory_order(std::memory_order order) noexcept
+		{
+			switch (order)
+			{
+			case std::memory_order_relaxed:
+				return __ATOMIC_RELAXED;
+			case std::memory_order_consume:
+				return __ATOMIC_CONSUME;
+			case std::memory_order_acquire:
+				return __ATOMIC_ACQUIRE;
+			case std::memory_order_release:
+				return __ATOMIC_RELEASE;
+			case std::memory_order_acq_rel:
+				return __ATOMIC_ACQ_REL;
+			case std::memory_order_seq_cst:
+			default:
+				return __ATOMIC_SEQ_CST;
+			}
+		}
+#endif
+
+		/// <summary>
+		/// The order a failed compare-exchange may use: it only loads, so drop any release part.
+		/// </summary>
+		constexpr std::memory_order failure_order_for(std::memory_order order) noexcept
+		{
+			switch (order)
+			{
+			case std::memory_order_release:
+				return std::memory_order_relaxed;
+			case std::memory_order_acq_rel:
+				return std::memory_order_acquire;
+			default:
+				return order;
+			}
+		}
+	}
+
+	constexpr atomic_uint128::atomic_uint128() noexcept : m_value{} {}
+
+#if defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+	constexpr atomic_uint128::atomic_uint128(uint128 desired) noexcept : m_value{ internal::to_native_u128(desired) } {}
+#else
+	constexpr atomic_uint128::atomic_uint128(uint128 desired) noexcept : m_value{ desired } {}
+#endif
+
+	inline bool atomic_uint128::is_lock_free() const noexcept
+	{
+		return is_always_lock_free;
+	}
+
+	inline bool atomic_uint128::compare_exchange(uint128& expected, uint128 desired,
+		[[maybe_unused]] std::memory_order success, [[maybe_unused]] std::memory_order failure) const noexcept
+	{
+#if defined(CJM_GNU_X64_ASM_CMPXCHG16B_AVAILABLE)
+		//compares rdx:rax with the destination; if equal stores rcx:rbx there, else loads it into rdx:rax.
+		//the lock prefix makes it a full barrier, so the requested orders are all satisfied.
+		std::uint64_t expected_low = expected.low_part();
+		std::uint64_t expected_high = expected.high_part();
+		bool exchanged;
+		__asm__ __volatile__("lock cmpxchg16b %[destination]"
+			: "=@ccz"(exchanged), [destination] "+m"(m_value), "+a"(expected_low), "+d"(expected_high)
+			: "b"(desired.low_part()), "c"(desired.high_part())
+			: "memory");
+		if (!exchanged)
+		{
+			expected = uint128::make_uint128(expected_high, expected_low);
+		}
+		return exchanged;
+#elif defined(CJM_MSVC_CMPXCHG16B_AVAILABLE)
+		//on failure, the comparand array receives the current value.
+		alignas(alignof(std::uint64_t) * 2) std::int64_t comparand[2] = { static_cast<std::int64_t>(expected.low_part()),
+			static_cast<std::int64_t>(expected.high_part()) };
+		const bool exchanged = _InterlockedCompareExchange128(reinterpret_cast<volatile std::int64_t*>(&m_value),
+			static_cast<std::int64_t>(desired.high_part()), static_cast<std::int64_t>(desired.low_part()), comparand) != 0;
+		if (!exchanged)
+		{
+			expected = uint128::make_uint128(static_cast<std::uint64_t>(comparand[1]), static_cast<std::uint64_t>(comparand[0]));
+		}
+		return exchanged;
+#elif defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+		unsigned __int128 native_expected = internal::to_native_u128(expected);
+		const bool exchanged = __atomic_compare_exchange_n(&m_value, &native_expected, internal::to_native_u128(desired),
+			false, internal::to_gnu_memory_order(success), internal::to_gnu_memory_order(failure));
+		if (!exchanged)
+		{
+			expected = internal::from_native_u128(native_expected);
+		}
+		return exchanged;
+#else
+		while (m_lock.test_and_set(std::memory_order_acquire)) {}
+		const bool exchanged = m_value == expected;
+		if (exchanged)
+		{
+			m_value = desired;
+		}
+		else
+		{
+			expected = m_value;
+		}
+		m_lock.clear(std::memory_order_release);
+		return exchanged;
+#endif
+	}
+
+	inline uint128 atomic_uint128::peek() const noexcept
+	{
+		//A first guess for compare-and-swap loops, which need not be atomic or current: a torn or
+		//stale guess just makes the first compare-and-swap fail and load the actual value.  Read with
+		//plain instructions, so an uncontended update costs one locked instruction rather than two.
+#if defined(CJM_GNU_X64_ASM_CMPXCHG16B_AVAILABLE)
+		std::uint64_t low;
+		std::uint64_t high;
+		__asm__ __volatile__("movq (%[address]), %[low]\n\tmovq 8(%[address]), %[high]"
+			: [low] "=r"(low), [high] "=r"(high) : [address] "r"(&m_value), "m"(m_value));
+		return uint128::make_uint128(high, low);
+#elif defined(CJM_MSVC_CMPXCHG16B_AVAILABLE)
+		const volatile std::int64_t* const limbs = reinterpret_cast<const volatile std::int64_t*>(&m_value);
+		return uint128::make_uint128(static_cast<std::uint64_t>(limbs[1]), static_cast<std::uint64_t>(limbs[0]));
+#elif defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+		return internal::from_native_u128(__atomic_load_n(&m_value, __ATOMIC_RELAXED));
+#else
+		return load(std::memory_order_relaxed);
+#endif
+	}
+
+	inline uint128 atomic_uint128::load([[maybe_unused]] std::memory_order order) const noexcept
+	{
+#if defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+		return internal::from_native_u128(__atomic_load_n(&m_value, internal::to_gnu_memory_order(order)));
+#elif defined(CJM_GNU_X64_ASM_CMPXCHG16B_AVAILABLE) || defined(CJM_MSVC_CMPXCHG16B_AVAILABLE)
+		//swapping zero for zero leaves the value alone and loads it whatever it is.
+		uint128 ret{};
+		compare_exchange(ret, ret, order, order);
+		return ret;
+#else
+		while (m_lock.test_and_set(std::memory_order_acquire)) {}
+		const uint128 ret = m_value;
+		m_lock.clear(std::memory_order_release);
+		return ret;
+#endif
+	}
+
+	inline atomic_uint128::operator uint128() const noexcept
+	{
+		return load();
+	}
+
+	inline void atomic_uint128::store(uint128 desired, std::memory_order order) noexcept
+	{
+#if defined(CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE)
+		__atomic_store_n(&m_value, internal::to_native_u128(desired), internal::to_gnu_memory_order(order));
+#else
+		exchange(desired, order);
+#endif
+	}
+
+	inline uint128 atomic_uint128::operator=(uint128 desired) noexcept
+	{
+		store(desired);
+		return desired;
+	}
+
+	inline uint128 atomic_uint128::exchange(uint128 desired, std::memory_order order) noexcept
+	{
+		return fetch_update([desired](uint128) noexcept { return desired; }, order);
+	}
+
+	inline bool atomic_uint128::compare_exchange_weak(uint128& expected, uint128 desired, std::memory_order success,
+		std::memory_order failure) noexcept
+	{
+		//a failed compare-exchange only loads: release orders are not allowed for it
+		assert(failure != std::memory_order_release && failure != std::memory_order_acq_rel);
+		return compare_exchange(expected, desired, success, failure);
+	}
+
+	inline bool atomic_uint128::compare_exchange_weak(uint128& expected, uint128 desired,
+		std::memory_order order) noexcept
+	{
+		return compare_exchange(expected, desired, order, internal::failure_order_for(order));
+	}
+
+	inline bool atomic_uint128::compare_exchange_strong(uint128& expected, uint128 desired, std::memory_order success,
+		std::memory_order failure) noexcept
+	{
+		//a failed compare-exchange only loads: release orders are not allowed for it
+		assert(failure != std::memory_order_release && failure != std::memory_order_acq_rel);
+		return compare_exchange(expected, desired, success, failure);
+	}
+
+	inline bool atomic_uint128::compare_exchange_strong(uint128& expected, uint128 desired,
+		std::memory_order order) noexcept
+	{
+		return compare_exchange(expected, desired, order, internal::failure_order_for(order));
+	}
+
+	template<typename Op>
+	uint128 atomic_uint128::fetch_update(Op op, std::memory_order order) noexcept
+	{
+		uint128 expected = peek();
+		while (!compare_exchange(expected, op(expected), order, internal::failure_order_for(order))) {}
+		return expected;
+	}
+
+	inline uint128 atomic_uint128::fetch_add(uint128 operand, std::memory_order order) noexcept
+	{
+		return fetch_update([operand](uint128 value) noexcept { return value + operand; }, order);
+	}
+
+	inline uint128 atomic_uint128::fetch_sub(uint128 operand, std::memory_order order) noexcept
+	{
+		return fetch_update([operand](uint128 value) noexcept { return value - operand; }, order);
+	}
+
+	inline uint128 atomic_uint128::fetch_and(uint128 operand, std::memory_order order) noexcept
+	{
+		return fetch_update([operand](uint128 value) noexcept { return value & operand; }, order);
+	}
+
+	inline uint128 atomic_uint128::fetch_or(uint128 operand, std::memory_order order) noexcept
+	{
+		return fetch_update([operand](uint128 value) noexcept { return value | operand; }, order);
+	}
+
+	inline uint128 atomic_uint128::fetch_xor(uint128 operand, std::memory_order order) noexcept
+	{
+		return fetch_update([operand](uint128 value) noexcept { return value ^ operand; }, order);
+	}
+
+	inline uint128 atomic_uint128::operator++() noexcept
+	{
+		return fetch_add(1) + 1;
+	}
+
+	inline uint128 atomic_uint128::operator++(int) noexcept
+	{
+		return fetch_add(1);
+	}
+
+	inline uint128 atomic_uint128::operator--() noexcept
+	{
+		return fetch_sub(1) - 1;
+	}
+
+	inline uint128 atomic_uint128::operator--(int) noexcept
+	{
+		return fetch_sub(1);
+	}
+
+	inline uint128 atomic_uint128::operator+=(uint128 operand) noexcept
+	{
+		return fetch_add(operand) + operand;
+	}
+
+	inline uint128 atomic_uint128::operator-=(uint128 operand) noexcept
+	{
+		return fetch_sub(operand) - operand;
+	}
+
+	inline uint128 atomic_uint128::operator&=(uint128 operand) noexcept
+	{
+		return fetch_and(operand) & operand;
+	}
+
+	inline uint128 atomic_uint128::operator|=(uint128 operand) noexcept
+	{
+		return fetch_or(operand) | operand;
+	}
+
+	inline uint128 atomic_uint128::operator^=(uint128 operand) noexcept
+	{
+		return fetch_xor(operand) ^ operand;
+	}
+}
+#endif
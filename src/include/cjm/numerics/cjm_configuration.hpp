@@ -53,12 +53,43 @@
 #ifdef __INTEL_LLVM_COMPILER
 #define CJM_DETECTED_INTEL_LLVM
 #endif
+#if defined(__AVX2__)
+#define CJM_DETECTED_AVX2
+#endif
+#if defined(__SSSE3__) || defined(__AVX__) || defined(CJM_DETECTED_AVX2)
+#define CJM_DETECTED_SSSE3
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CJM_DETECTED_SSE2
+#endif
 #if defined (CJM_DETECTED_WINDOWS) && defined(CJM_DETECTED_X64) && !defined(CJM_DETECTED_GCC) && !defined(CJM_DETECTED_INTEL_CLASSIC) && !defined(CJM_DETECTED_INTEL_LLVM) && !defined(CJM_DETECTED_CLANG)
 #define CJM_UDIV_INTRINSIC_AVAILABLE
 #endif
 #if defined (CJM_DETECTED_WINDOWS) && defined(CJM_DETECTED_X64) && !defined(CJM_DETECTED_GCC)
 #define CJM_BASE_INTRINSICS_AVAILABLE
 #endif
+#if (defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)) && defined(__x86_64__) && !defined(CJM_UDIV_INTRINSIC_AVAILABLE)
+#define CJM_GNU_X64_ASM_DIVQ_AVAILABLE
+#endif
+#if (defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)) && defined(__x86_64__)
+#define CJM_GNU_X64_ASM_CMPXCHG16B_AVAILABLE
+#elif defined (CJM_DETECTED_WINDOWS) && defined(CJM_DETECTED_X64)
+#define CJM_MSVC_CMPXCHG16B_AVAILABLE
+#elif (defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)) && defined(__aarch64__) && defined(CJM_DETECTED_INTRINSIC_U128)
+#define CJM_GNU_AARCH64_ATOMIC_U128_AVAILABLE
+#endif
+#if ((defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)) && defined(__x86_64__)) || (defined(CJM_DETECTED_WINDOWS) && defined(CJM_DETECTED_X64))
+#define CJM_X64_CPU_DISPATCH_AVAILABLE
+#endif
+#if defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)
+#define CJM_TARGET_BMI2_ADX __attribute__((target("bmi2,adx")))
+#define CJM_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define CJM_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define CJM_TARGET_BMI2_ADX
+#define CJM_TARGET_SSSE3
+#define CJM_TARGET_AVX2
+#endif
 #if defined (CJM_DETECTED_WINDOWS) && defined(CJM_DETECTED_X64) && defined(CJM_DETECTED_CLANG) && defined(__ADX__) && !defined(CJM_NUMERICS_UINT128_INTEL_ADX)
 #define CJM_NUMERICS_UINT128_INTEL_ADX
 #endif
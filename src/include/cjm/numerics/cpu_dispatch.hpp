@@ -0,0 +1,130 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_CPU_DISPATCH_HPP_
+#define CJM_CPU_DISPATCH_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <cjm/numerics/cpu_features.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+#include <immintrin.h>
+#endif
+
+namespace cjm::numerics
+{
+	/************************************************************************/
+	/* Arithmetic on arbitrarily long little-endian (least significant limb
+	 * first) spans of 64-bit limbs.  Each operation is implemented twice:
+	 * portably and with BMI2 (mulx) and ADX (adcx/adox) intrinsics.  The
+	 * latter are compiled for those extensions whatever the compiler flags
+	 * (through a target attribute on GCC and Clang), and the implementation
+	 * is chosen once, the first time one of these functions is called, from
+	 * detected_cpu_features().  So one binary built without -mbmi2 -madx
+	 * uses them where the host has them and still runs where it does not.
+	 * Where the build already assumes BMI2 and ADX, no cpuid check is made.
+	 *																		*/
+	/************************************************************************/
+	namespace multi_limb
+	{
+		/// <summary>
+		/// sum = augend + addend + carry_in.  All three spans must be the same length; sum
+		/// may be the same span as either addend.
+		/// </summary>
+		/// <returns>the carry out of the most significant limb.</returns>
+		inline unsigned char add(std::span<const std::uint64_t> augend, std::span<const std::uint64_t> addend,
+			std::span<std::uint64_t> sum, unsigned char carry_in = 0) noexcept;
+
+		/// <summary>
+		/// difference = minuend - subtrahend - borrow_in.  All three spans must be the same
+		/// length; difference may be the same span as either operand.
+		/// </summary>
+		/// <returns>the borrow out of the most significant limb.</returns>
+		inline unsigned char sub(std::span<const std::uint64_t> minuend, std::span<const std::uint64_t> subtrahend,
+			std::span<std::uint64_t> difference, unsigned char borrow_in = 0) noexcept;
+
+		/// <summary>
+		/// accumulator += multiplicand * multiplier, where accumulator is as long as multiplicand.
+		/// </summary>
+		/// <returns>the limb carried out of the top of accumulator.</returns>
+		inline std::uint64_t multiply_add_u64(std::span<std::uint64_t> accumulator,
+			std::span<const std::uint64_t> multiplicand, std::uint64_t multiplier) noexcept;
+
+		/// <summary>
+		/// product = multiplicand * multiplier (schoolbook).  product must be exactly as long as
+		/// both inputs together and must not overlap either of them.
+		/// </summary>
+		inline void multiply(std::span<const std::uint64_t> multiplicand, std::span<const std::uint64_t> multiplier,
+			std::span<std::uint64_t> product) noexcept;
+
+		/// <summary>
+		/// The implementation in use: "bmi2_adx" or "portable".
+		/// </summary>
+		inline std::string_view kernel_name() noexcept;
+	}
+
+	namespace internal
+	{
+		/// <summary>
+		/// One implementation of the multi_limb operations, on pointers and a limb count.
+		/// </summary>
+		struct multi_limb_kernels final
+		{
+			std::string_view name;
+			unsigned char (*add)(const std::uint64_t* augend, const std::uint64_t* addend, std::uint64_t* sum,
+				size_t limbs, unsigned char carry_in) noexcept;
+			unsigned char (*sub)(const std::uint64_t* minuend, const std::uint64_t* subtrahend,
+				std::uint64_t* difference, size_t limbs, unsigned char borrow_in) noexcept;
+			std::uint64_t (*multiply_add_u64)(std::uint64_t* accumulator, const std::uint64_t* multiplicand,
+				size_t limbs, std::uint64_t multiplier) noexcept;
+		};
+
+		inline unsigned char add_limbs_portable(const std::uint64_t* augend, const std::uint64_t* addend,
+			std::uint64_t* sum, size_t limbs, unsigned char carry_in) noexcept;
+		inline unsigned char sub_limbs_portable(const std::uint64_t* minuend, const std::uint64_t* subtrahend,
+			std::uint64_t* difference, size_t limbs, unsigned char borrow_in) noexcept;
+		inline std::uint64_t multiply_add_limbs_portable(std::uint64_t* accumulator, const std::uint64_t* multiplicand,
+			size_t limbs, std::uint64_t multiplier) noexcept;
+
+		constexpr multi_limb_kernels portable_multi_limb_kernels{ "portable", &add_limbs_portable,
+			&sub_limbs_portable, &multiply_add_limbs_portable };
+
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+		CJM_TARGET_BMI2_ADX inline unsigned char add_limbs_bmi2_adx(const std::uint64_t* augend,
+			const std::uint64_t* addend, std::uint64_t* sum, size_t limbs, unsigned char carry_in) noexcept;
+		CJM_TARGET_BMI2_ADX inline unsigned char sub_limbs_bmi2_adx(const std::uint64_t* minuend,
+			const std::uint64_t* subtrahend, std::uint64_t* difference, size_t limbs, unsigned char borrow_in) noexcept;
+		CJM_TARGET_BMI2_ADX inline std::uint64_t multiply_add_limbs_bmi2_adx(std::uint64_t* accumulator,
+			const std::uint64_t* multiplicand, size_t limbs, std::uint64_t multiplier) noexcept;
+
+		constexpr multi_limb_kernels bmi2_adx_multi_limb_kernels{ "bmi2_adx", &add_limbs_bmi2_adx,
+			&sub_limbs_bmi2_adx, &multiply_add_limbs_bmi2_adx };
+#endif
+
+		/// <summary>
+		/// The kernels the multi_limb functions use: chosen on the first call.
+		/// </summary>
+		inline const multi_limb_kernels& selected_multi_limb_kernels() noexcept;
+	}
+}
+#include <cjm/numerics/cpu_dispatch.inl>
+#endif
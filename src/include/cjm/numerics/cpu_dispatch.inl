@@ -0,0 +1,175 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_CPU_DISPATCH_INL_
+#define CJM_CPU_DISPATCH_INL_
+#include <cjm/numerics/cpu_dispatch.hpp>
+
+namespace cjm::numerics
+{
+	namespace multi_limb
+	{
+		inline unsigned char add(std::span<const std::uint64_t> augend, std::span<const std::uint64_t> addend,
+			std::span<std::uint64_t> sum, unsigned char carry_in) noexcept
+		{
+			assert(augend.size() == addend.size() && augend.size() == sum.size());
+			return internal::selected_multi_limb_kernels().add(augend.data(), addend.data(), sum.data(),
+				sum.size(), carry_in);
+		}
+
+		inline unsigned char sub(std::span<const std::uint64_t> minuend, std::span<const std::uint64_t> subtrahend,
+			std::span<std::uint64_t> difference, unsigned char borrow_in) noexcept
+		{
+			assert(minuend.size() == subtrahend.size() && minuend.size() == difference.size());
+			return internal::selected_multi_limb_kernels().sub(minuend.data(), subtrahend.data(), difference.data(),
+				difference.size(), borrow_in);
+		}
+
+		inline std::uint64_t multiply_add_u64(std::span<std::uint64_t> accumulator,
+			std::span<const std::uint64_t> multiplicand, std::uint64_t multiplier) noexcept
+		{
+			assert(accumulator.size() == multiplicand.size());
+			return internal::selected_multi_limb_kernels().multiply_add_u64(accumulator.data(), multiplicand.data(),
+				multiplicand.size(), multiplier);
+		}
+
+		inline void multiply(std::span<const std::uint64_t> multiplicand, std::span<const std::uint64_t> multiplier,
+			std::span<std::uint64_t> product) noexcept
+		{
+			assert(product.size() == multiplicand.size() + multiplier.size());
+			const internal::multi_limb_kernels& kernels = internal::selected_multi_limb_kernels();
+			std::fill(product.begin(), product.end(), std::uint64_t{ 0 });
+			//one row per multiplier limb: each adds multiplicand * limb into the product one limb further up
+			for (size_t i = 0; i < multiplier.size(); ++i)
+			{
+				product[i + multiplicand.size()] = kernels.multiply_add_u64(product.data() + i, multiplicand.data(),
+					multiplicand.size(), multiplier[i]);
+			}
+		}
+
+		inline std::string_view kernel_name() noexcept
+		{
+			return internal::selected_multi_limb_kernels().name;
+		}
+	}
+
+	namespace internal
+	{
+		inline unsigned char add_limbs_portable(const std::uint64_t* augend, const std::uint64_t* addend,
+			std::uint64_t* sum, size_t limbs, unsigned char carry_in) noexcept
+		{
+			unsigned char carry = carry_in;
+			for (size_t i = 0; i < limbs; ++i)
+			{
+				sum[i] = numerics::add_with_carry(augend[i], addend[i], carry, carry);
+			}
+			return carry;
+		}
+
+		inline unsigned char sub_limbs_portable(const std::uint64_t* minuend, const std::uint64_t* subtrahend,
+			std::uint64_t* difference, size_t limbs, unsigned char borrow_in) noexcept
+		{
+			unsigned char borrow = borrow_in;
+			for (size_t i = 0; i < limbs; ++i)
+			{
+				difference[i] = numerics::sub_with_borrow(minuend[i], subtrahend[i], borrow, borrow);
+			}
+			return borrow;
+		}
+
+		inline std::uint64_t multiply_add_limbs_portable(std::uint64_t* accumulator, const std::uint64_t* multiplicand,
+			size_t limbs, std::uint64_t multiplier) noexcept
+		{
+			std::uint64_t carry = 0;
+			for (size_t i = 0; i < limbs; ++i)
+			{
+				//cannot overflow: (2^64 - 1)^2 + 2 * (2^64 - 1) == 2^128 - 1
+				const uint128 product = full_multiply_u64(multiplicand[i], multiplier) + accumulator[i] + carry;
+				accumulator[i] = product.low_part();
+				carry = product.high_part();
+			}
+			return carry;
+		}
+
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+		CJM_TARGET_BMI2_ADX inline unsigned char add_limbs_bmi2_adx(const std::uint64_t* augend,
+			const std::uint64_t* addend, std::uint64_t* sum, size_t limbs, unsigned char carry_in) noexcept
+		{
+			unsigned char carry = carry_in;
+			for (size_t i = 0; i < limbs; ++i)
+			{
+				unsigned long long limb;
+				carry = _addcarryx_u64(carry, augend[i], addend[i], &limb);
+				sum[i] = limb;
+			}
+			return carry;
+		}
+
+		CJM_TARGET_BMI2_ADX inline unsigned char sub_limbs_bmi2_adx(const std::uint64_t* minuend,
+			const std::uint64_t* subtrahend, std::uint64_t* difference, size_t limbs, unsigned char borrow_in) noexcept
+		{
+			unsigned char borrow = borrow_in;
+			for (size_t i = 0; i < limbs; ++i)
+			{
+				unsigned long long limb;
+				borrow = _subborrow_u64(borrow, minuend[i], subtrahend[i], &limb);
+				difference[i] = limb;
+			}
+			return borrow;
+		}
+
+		CJM_TARGET_BMI2_ADX inline std::uint64_t multiply_add_limbs_bmi2_adx(std::uint64_t* accumulator,
+			const std::uint64_t* multiplicand, size_t limbs, std::uint64_t multiplier) noexcept
+		{
+			//mulx leaves the flags alone, so the two carry chains -- each high half into the next
+			//low half, and each partial product into the accumulator -- can be kept in CF and OF
+			//(adcx and adox) and interleaved with the multiplies
+			unsigned char product_carry = 0;
+			unsigned char accumulator_carry = 0;
+			unsigned long long previous_high = 0;
+			for (size_t i = 0; i < limbs; ++i)
+			{
+				unsigned long long high;
+				const unsigned long long low = _mulx_u64(multiplicand[i], multiplier, &high);
+				unsigned long long term;
+				product_carry = _addcarryx_u64(product_carry, low, previous_high, &term);
+				unsigned long long limb;
+				accumulator_carry = _addcarryx_u64(accumulator_carry, accumulator[i], term, &limb);
+				accumulator[i] = limb;
+				previous_high = high;
+			}
+			//cannot overflow: the high half of a product is at most 2^64 - 2
+			return previous_high + product_carry + accumulator_carry;
+		}
+#endif
+
+		inline const multi_limb_kernels& selected_multi_limb_kernels() noexcept
+		{
+#if defined(CJM_X64_CPU_DISPATCH_AVAILABLE) && defined(__BMI2__) && defined(__ADX__)
+			return bmi2_adx_multi_limb_kernels;
+#elif defined(CJM_X64_CPU_DISPATCH_AVAILABLE)
+			static const multi_limb_kernels& kernels = detected_cpu_features().bmi2 && detected_cpu_features().adx
+				? bmi2_adx_multi_limb_kernels : portable_multi_limb_kernels;
+			return kernels;
+#else
+			return portable_multi_limb_kernels;
+#endif
+		}
+	}
+}
+#endif
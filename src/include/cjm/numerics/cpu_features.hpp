@@ -0,0 +1,68 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_CPU_FEATURES_HPP_
+#define CJM_CPU_FEATURES_HPP_
+#include <cjm/numerics/cjm_configuration.hpp>
+#include <array>
+#include <cstdint>
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+#ifdef CJM_DETECTED_WINDOWS
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#endif
+
+namespace cjm::numerics
+{
+	/// <summary>
+	/// The instruction set extensions of the processor the program is running on (not merely
+	/// the ones the compiler was told to assume).  Everything is false off x64.
+	/// </summary>
+	struct cpu_features final
+	{
+		bool ssse3 = false;
+		bool avx2 = false;
+		bool bmi2 = false;
+		bool adx = false;
+		bool lzcnt = false;
+	};
+
+	/// <summary>
+	/// Queries cpuid the first time it is called.
+	/// </summary>
+	/// <returns>the running processor's features.</returns>
+	inline const cpu_features& detected_cpu_features() noexcept;
+
+	namespace internal
+	{
+		inline cpu_features detect_cpu_features() noexcept;
+
+		/// <summary>
+		/// Whether the SSSE3 (or AVX2) kernels, which are compiled through a target attribute
+		/// whatever the compiler flags, may run: true without a cpuid check where the build
+		/// already assumes the extension.
+		/// </summary>
+		inline bool can_use_ssse3() noexcept;
+		inline bool can_use_avx2() noexcept;
+	}
+}
+#include <cjm/numerics/cpu_features.inl>
+#endif
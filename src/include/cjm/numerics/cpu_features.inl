@@ -0,0 +1,107 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_CPU_FEATURES_INL_
+#define CJM_CPU_FEATURES_INL_
+#include <cjm/numerics/cpu_features.hpp>
+
+namespace cjm::numerics
+{
+	inline const cpu_features& detected_cpu_features() noexcept
+	{
+		static const cpu_features features = internal::detect_cpu_features();
+		return features;
+	}
+
+	namespace internal
+	{
+		inline cpu_features detect_cpu_features() noexcept
+		{
+			cpu_features features{};
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+			//registers[0..3] = eax, ebx, ecx, edx
+			std::array<std::uint32_t, 4> registers{};
+			auto cpuid = [&registers](std::uint32_t leaf, std::uint32_t sub_leaf) -> void
+			{
+#ifdef CJM_DETECTED_WINDOWS
+				std::array<int, 4> values{};
+				__cpuidex(values.data(), static_cast<int>(leaf), static_cast<int>(sub_leaf));
+				for (size_t i = 0; i < registers.size(); ++i)
+					registers[i] = static_cast<std::uint32_t>(values[i]);
+#else
+				__cpuid_count(leaf, sub_leaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+			};
+			cpuid(0, 0);
+			const std::uint32_t max_leaf = registers[0];
+			cpuid(0x8000'0000u, 0);
+			const std::uint32_t max_extended_leaf = registers[0];
+			if (max_leaf >= 1)
+			{
+				cpuid(1, 0);
+				features.ssse3 = (registers[2] & (1u << 9)) != 0;
+				//avx2 also needs the operating system to save the ymm registers (xcr0 bits 1 and 2)
+				bool os_saves_ymm = false;
+				if ((registers[2] & (1u << 27)) != 0)
+				{
+#ifdef CJM_DETECTED_WINDOWS
+					const auto xcr0 = static_cast<std::uint64_t>(_xgetbv(0));
+#else
+					std::uint32_t xcr0_low = 0, xcr0_high = 0;
+					__asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+					const std::uint64_t xcr0 = (static_cast<std::uint64_t>(xcr0_high) << 32) | xcr0_low;
+#endif
+					os_saves_ymm = (xcr0 & 0x6u) == 0x6u;
+				}
+				if (max_leaf >= 7)
+				{
+					cpuid(7, 0);
+					features.avx2 = os_saves_ymm && (registers[1] & (1u << 5)) != 0;
+					features.bmi2 = (registers[1] & (1u << 8)) != 0;
+					features.adx = (registers[1] & (1u << 19)) != 0;
+				}
+			}
+			if (max_extended_leaf >= 0x8000'0001u)
+			{
+				cpuid(0x8000'0001u, 0);
+				features.lzcnt = (registers[2] & (1u << 5)) != 0;
+			}
+#endif
+			return features;
+		}
+
+		inline bool can_use_ssse3() noexcept
+		{
+#ifdef CJM_DETECTED_SSSE3
+			return true;
+#else
+			return detected_cpu_features().ssse3;
+#endif
+		}
+
+		inline bool can_use_avx2() noexcept
+		{
+#ifdef CJM_DETECTED_AVX2
+			return true;
+#else
+			return detected_cpu_features().avx2;
+#endif
+		}
+	}
+}
+#endif
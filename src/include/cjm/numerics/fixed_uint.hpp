@@ -0,0 +1,415 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_FIXED_UINT_HPP_
+#define CJM_FIXED_UINT_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace cjm::numerics::internal
+{
+	/// <summary>
+	/// Number of 64-bit limbs in a cjm unsigned integer (or in std::uint64_t).
+	/// </summary>
+	template<typename Ui>
+	constexpr size_t u64_limb_count_v = static_cast<size_t>(std::numeric_limits<Ui>::digits)
+		/ static_cast<size_t>(std::numeric_limits<std::uint64_t>::digits);
+
+	/// <summary>
+	/// A flat, little-endian (least significant limb first) view of a fixed_uint.
+	/// fixed_uint's arithmetic is done on these rather than by recursing through its halves.
+	/// </summary>
+	template<size_t LimbCount>
+	using u64_limbs = std::array<std::uint64_t, LimbCount>;
+
+	/// <summary>
+	/// Accepts cjm unsigned integers narrower than Wide (other than Wide's own int_part,
+	/// which fixed_uint handles directly).  Checks the cheap traits first so that
+	/// it never asks whether Wide itself satisfies cjm_unsigned_integer.
+	/// </summary>
+	template<typename Ui, typename Wide>
+	concept narrower_cjm_unsigned_integer = std::is_same_v<Ui, std::remove_cvref_t<Ui>> &&
+		!std::is_integral_v<Ui> && !std::is_same_v<Ui, Wide> &&
+		!std::is_same_v<Ui, typename Wide::int_part> &&
+		std::numeric_limits<Ui>::is_specialized && !std::numeric_limits<Ui>::is_signed &&
+		std::numeric_limits<Ui>::digits < std::numeric_limits<Wide>::digits &&
+		concepts::cjm_unsigned_integer<Ui>;
+
+	template<typename Ui>
+	constexpr void store_u64_limbs(Ui value, std::uint64_t* dest) noexcept;
+
+	template<typename Ui>
+	constexpr Ui load_u64_limbs(const std::uint64_t* src) noexcept;
+
+	template<size_t LimbCount>
+	constexpr unsigned char add_limbs(u64_limbs<LimbCount>& augend, const u64_limbs<LimbCount>& addend) noexcept;
+
+	template<size_t LimbCount>
+	constexpr unsigned char sub_limbs(u64_limbs<LimbCount>& minuend, const u64_limbs<LimbCount>& subtrahend) noexcept;
+
+	/// <summary>
+	/// Schoolbook multiplication truncated to LimbCount limbs: partial products
+	/// that land entirely above the result are never computed.
+	/// </summary>
+	template<size_t LimbCount>
+	constexpr u64_limbs<LimbCount> multiply_limbs(const u64_limbs<LimbCount>& multiplicand,
+		const u64_limbs<LimbCount>& multiplier) noexcept;
+
+	template<size_t LimbCount>
+	constexpr u64_limbs<LimbCount> shift_left_limbs(const u64_limbs<LimbCount>& limbs, int amount) noexcept;
+
+	template<size_t LimbCount>
+	constexpr u64_limbs<LimbCount> shift_right_limbs(const u64_limbs<LimbCount>& limbs, int amount) noexcept;
+
+	template<size_t LimbCount>
+	constexpr std::strong_ordering compare_limbs(const u64_limbs<LimbCount>& lhs, const u64_limbs<LimbCount>& rhs) noexcept;
+
+	/// <summary>
+	/// The number of limbs up to and including the most significant non-zero limb.
+	/// </summary>
+	template<size_t LimbCount>
+	constexpr size_t significant_limbs(const u64_limbs<LimbCount>& limbs) noexcept;
+
+	/// <summary>
+	/// limbs = limbs * multiplier + addend.
+	/// </summary>
+	/// <returns>false if the result did not fit (limbs then holds it modulo 2^(64 * LimbCount)).</returns>
+	template<size_t LimbCount>
+	constexpr bool multiply_add_limbs_u64(u64_limbs<LimbCount>& limbs, std::uint64_t multiplier,
+		std::uint64_t addend) noexcept;
+
+	/// <summary>
+	/// Divides limbs in place by a divisor that was normalized (shifted left by shift
+	/// so its top bit is set) and whose reciprocal_2by1 has already been computed.
+	/// </summary>
+	/// <returns>the (unnormalized) remainder.</returns>
+	template<size_t LimbCount>
+	constexpr std::uint64_t div_mod_limbs_normalized_u64(u64_limbs<LimbCount>& limbs,
+		std::uint64_t normalized_divisor, std::uint64_t reciprocal, int shift) noexcept;
+
+	template<size_t LimbCount>
+	constexpr std::uint64_t div_mod_limbs_u64(u64_limbs<LimbCount>& limbs, std::uint64_t divisor) noexcept;
+
+	/// <summary>
+	/// Knuth's algorithm D (TAOCP vol. 2, 4.3.1) on 64-bit limbs.  Each quotient limb is
+	/// estimated with a precomputed-reciprocal 2-by-1 division rather than a hardware divide.
+	/// divisor must not be zero.
+	/// </summary>
+	template<size_t LimbCount>
+	constexpr void div_mod_limbs(const u64_limbs<LimbCount>& dividend, const u64_limbs<LimbCount>& divisor,
+		u64_limbs<LimbCount>& quotient, u64_limbs<LimbCount>& remainder) noexcept;
+
+	template<size_t LimbCount>
+	constexpr char* write_limbs_digits_backward(char* end, u64_limbs<LimbCount> limbs, int base) noexcept;
+
+	template<size_t LimbCount>
+	constexpr std::from_chars_result parse_limbs_digits(const char* first, const char* last,
+		u64_limbs<LimbCount>& limbs, int base) noexcept;
+}
+
+namespace std
+{
+	template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+	struct hash<cjm::numerics::fixed_uint<LimbType>> final
+	{
+		constexpr hash() noexcept = default;
+		constexpr size_t operator()(const cjm::numerics::fixed_uint<LimbType>& key_val) const noexcept;
+	};
+
+	/************************************************************************/
+	/* Defines numeric limits and various traits for fixed_uint
+	* to facilitate interoperability with code that relies on these traits.  */
+	/************************************************************************/
+	template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+	class numeric_limits<cjm::numerics::fixed_uint<LimbType>> final
+	{
+	public:
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = false;
+		static constexpr bool is_integer{ true };
+		static constexpr bool is_exact = true;
+		static constexpr bool is_bounded = true;
+		static constexpr bool has_denorm = std::denorm_absent;
+		static constexpr bool has_infinity = false;
+		static constexpr bool has_quiet_NaN = std::numeric_limits<uint64_t>::has_quiet_NaN;
+		static constexpr bool has_signaling_NaN = std::numeric_limits<uint64_t>::has_signaling_NaN;
+		static constexpr bool has_denorm_loss = std::numeric_limits<uint64_t>::has_denorm_loss;
+		static constexpr std::float_round_style round_style = std::numeric_limits<uint64_t>::round_style;
+		static constexpr bool is_arithmetic = true;
+		static constexpr bool is_iec559 = std::numeric_limits<uint64_t>::is_iec559;
+		static constexpr bool is_modulo = std::numeric_limits<uint64_t>::is_modulo;
+		static constexpr int digits = std::numeric_limits<LimbType>::digits * 2;
+		static constexpr int digits10 = digits * 301'299 / 1'000'000;
+		static constexpr int max_digits10 = std::numeric_limits<uint64_t>::max_digits10;
+		static constexpr int radix = 2;
+		static constexpr int min_exponent = 0;
+		static constexpr int max_exponent = 0;
+		static constexpr int min_exponent10 = 0;
+		static constexpr int max_exponent10 = 0;
+		static constexpr bool traps = true;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> min() noexcept;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> lowest() noexcept;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> max() noexcept;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> epsilon() noexcept;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> round_error() noexcept;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> infinity() noexcept;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> quiet_NaN() noexcept;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> signaling_NaN() noexcept;
+
+		static constexpr cjm::numerics::fixed_uint<LimbType> denorm_min() noexcept;
+	};
+}
+
+namespace cjm::numerics
+{
+	/************************************************************************/
+	/* An unsigned integer twice as wide as LimbType, built out of a high and
+	 * a low LimbType: fixed_uint<uint128> is a 256-bit unsigned integer and
+	 * fixed_uint<fixed_uint<uint128>> is a 512-bit one (see the uint256 and
+	 * uint512 aliases below).
+	 *
+	 * It offers the same interface and guarantees as uint128: constexpr,
+	 * noexcept arithmetic (only division and modulus throw, on a zero divisor),
+	 * numeric_limits, std::hash, literals, to_chars/from_chars and stream
+	 * insertion/extraction, and it satisfies cjm_unsigned_integer -- so it can
+	 * itself be the LimbType of a wider fixed_uint.
+	 *
+	 * The arithmetic does not recurse through the halves: each operation
+	 * flattens its operands into an array of 64-bit limbs, runs a single carry
+	 * chain (or schoolbook multiply, or Knuth division) over it and rebuilds
+	 * the result.  Those conversions are plain copies the optimizer removes.
+	 *																		*/
+	/************************************************************************/
+	template<concepts::cjm_unsigned_integer LimbType>
+	class fixed_uint final
+	{
+	public:
+		using int_part = LimbType;
+		static constexpr size_t limb_count = internal::u64_limb_count_v<int_part> * 2;
+		using limb_array = internal::u64_limbs<limb_count>;
+		static constexpr size_t byte_array_size = limb_count * sizeof(std::uint64_t);
+		using byte_array = std::array<unsigned char, byte_array_size>;
+		using divmod_result_t = divmod_result<fixed_uint>;
+
+		static constexpr int int_part_bits{ std::numeric_limits<int_part>::digits };
+		static constexpr int int_part_bottom_half_bits{ int_part_bits / 2 };
+		static constexpr int_part int_part_bottom_half_bitmask{
+			std::numeric_limits<int_part>::max() >> int_part_bottom_half_bits };
+
+		/// <summary>
+		/// Parses decimal or 0x-prefixed hexadecimal text (surrounding whitespace is ignored).
+		/// </summary>
+		/// <exception cref="std::invalid_argument">text is not in that form.</exception>
+		/// <exception cref="std::overflow_error">the value is too large for this type.</exception>
+		static constexpr fixed_uint make_from_string(std::string_view text);
+
+		/// <summary>
+		/// Parses text accepted by make_from_string without throwing.
+		/// </summary>
+		/// <returns>the value, or std::nullopt if text cannot be parsed into this type.</returns>
+		static constexpr std::optional<fixed_uint> try_make_from_string(std::string_view text) noexcept;
+
+		static constexpr fixed_uint make_from_bytes_little_endian(byte_array bytes) noexcept;
+		static constexpr fixed_uint make_from_bytes_big_endian(byte_array bytes) noexcept;
+		static constexpr fixed_uint make_fixed_uint(int_part high, int_part low) noexcept;
+
+		/// <summary>
+		/// Builds a value from 64-bit limbs, least significant first.
+		/// </summary>
+		static constexpr fixed_uint make_from_limbs(const limb_array& limbs) noexcept;
+
+		static constexpr std::optional<divmod_result_t> try_div_mod(fixed_uint dividend,
+			fixed_uint divisor) noexcept;
+		static constexpr divmod_result_t div_mod(fixed_uint dividend, fixed_uint divisor);
+		static constexpr divmod_result_t unsafe_div_mod(fixed_uint dividend,
+			fixed_uint divisor) noexcept;
+
+		static constexpr int most_sign_set_bit(fixed_uint value) noexcept;
+
+		constexpr fixed_uint() noexcept : m_low{}, m_high{} {}
+		constexpr fixed_uint(const fixed_uint& other) noexcept = default;
+		constexpr fixed_uint(fixed_uint&& other) noexcept = default;
+		constexpr fixed_uint& operator=(const fixed_uint& other) noexcept = default;
+		constexpr fixed_uint& operator=(fixed_uint&& other) noexcept = default;
+		constexpr ~fixed_uint() noexcept = default;
+		constexpr explicit fixed_uint(int_part high, int_part low) noexcept;
+		constexpr fixed_uint(int_part low) noexcept;
+
+		//from the builtin integers: negative values are sign-extended, just as with uint128
+		template<concepts::builtin_integer Integer>
+		constexpr fixed_uint(Integer value) noexcept;
+
+		//from narrower cjm unsigned integers
+		template<internal::narrower_cjm_unsigned_integer<fixed_uint> Ui>
+		constexpr fixed_uint(Ui value) noexcept;
+
+		template<concepts::builtin_floating_point TFloat>
+		inline explicit fixed_uint(TFloat value) noexcept;
+
+		constexpr explicit operator bool() const noexcept;
+
+		//to the builtin integers: truncates
+		template<typename Integer>
+			requires (std::is_integral_v<Integer> && !std::is_same_v<Integer, bool> && concepts::builtin_integer<Integer>)
+		constexpr explicit operator Integer() const noexcept;
+
+		//to narrower cjm unsigned integers (including int_part): truncates
+		template<typename Ui>
+			requires (std::is_same_v<Ui, int_part> || internal::narrower_cjm_unsigned_integer<Ui, fixed_uint>)
+		constexpr explicit operator Ui() const noexcept;
+
+		template<concepts::builtin_floating_point TFloat>
+		inline explicit operator TFloat() const;
+
+		[[nodiscard]] constexpr int_part low_part() const noexcept;
+		[[nodiscard]] constexpr int_part high_part() const noexcept;
+		[[nodiscard]] constexpr limb_array to_limbs() const noexcept;
+		[[nodiscard]] constexpr byte_array to_little_endian_arr() const noexcept;
+		[[nodiscard]] constexpr byte_array to_big_endian_arr() const noexcept;
+		[[nodiscard]] constexpr size_t hash_code() const noexcept;
+
+		constexpr fixed_uint& operator+=(fixed_uint other) noexcept;
+		constexpr fixed_uint& operator-=(fixed_uint other) noexcept;
+		constexpr fixed_uint& operator*=(fixed_uint other) noexcept;
+		constexpr fixed_uint& operator/=(fixed_uint other);
+		constexpr fixed_uint& operator%=(fixed_uint other);
+		constexpr fixed_uint& operator&=(fixed_uint other) noexcept;
+		constexpr fixed_uint& operator|=(fixed_uint other) noexcept;
+		constexpr fixed_uint& operator^=(fixed_uint other) noexcept;
+		constexpr fixed_uint& operator<<=(int amount) noexcept;
+		constexpr fixed_uint& operator>>=(int amount) noexcept;
+		constexpr fixed_uint& operator<<=(unsigned amount) noexcept;
+		constexpr fixed_uint& operator>>=(unsigned amount) noexcept;
+		constexpr fixed_uint& operator<<=(fixed_uint amount) noexcept;
+		constexpr fixed_uint& operator>>=(fixed_uint amount) noexcept;
+		constexpr fixed_uint& operator++() noexcept;
+		constexpr fixed_uint& operator--() noexcept;
+		constexpr fixed_uint operator++(int) noexcept;
+		constexpr fixed_uint operator--(int) noexcept;
+
+		//Hidden friends, so that either operand may be anything implicitly convertible to fixed_uint.
+		friend constexpr fixed_uint operator+(fixed_uint lhs, fixed_uint rhs) noexcept { return lhs += rhs; }
+		friend constexpr fixed_uint operator-(fixed_uint lhs, fixed_uint rhs) noexcept { return lhs -= rhs; }
+		friend constexpr fixed_uint operator*(fixed_uint lhs, fixed_uint rhs) noexcept { return lhs *= rhs; }
+		friend constexpr fixed_uint operator/(fixed_uint lhs, fixed_uint rhs) { return lhs /= rhs; }
+		friend constexpr fixed_uint operator%(fixed_uint lhs, fixed_uint rhs) { return lhs %= rhs; }
+		friend constexpr fixed_uint operator&(fixed_uint lhs, fixed_uint rhs) noexcept { return lhs &= rhs; }
+		friend constexpr fixed_uint operator|(fixed_uint lhs, fixed_uint rhs) noexcept { return lhs |= rhs; }
+		friend constexpr fixed_uint operator^(fixed_uint lhs, fixed_uint rhs) noexcept { return lhs ^= rhs; }
+		friend constexpr fixed_uint operator<<(fixed_uint lhs, int amount) noexcept { return lhs <<= amount; }
+		friend constexpr fixed_uint operator>>(fixed_uint lhs, int amount) noexcept { return lhs >>= amount; }
+		friend constexpr fixed_uint operator<<(fixed_uint lhs, fixed_uint amount) noexcept { return lhs <<= amount; }
+		friend constexpr fixed_uint operator>>(fixed_uint lhs, fixed_uint amount) noexcept { return lhs >>= amount; }
+		friend constexpr fixed_uint operator+(fixed_uint operand) noexcept { return operand; }
+		friend constexpr fixed_uint operator-(fixed_uint operand) noexcept { return ~operand + 1; }
+		friend constexpr fixed_uint operator~(fixed_uint operand) noexcept { return fixed_uint{ ~operand.m_high, ~operand.m_low }; }
+		friend constexpr bool operator!(fixed_uint operand) noexcept { return !static_cast<bool>(operand); }
+		friend constexpr bool operator==(fixed_uint lhs, fixed_uint rhs) noexcept
+		{
+			return lhs.m_low == rhs.m_low && lhs.m_high == rhs.m_high;
+		}
+		friend constexpr std::strong_ordering operator<=>(fixed_uint lhs, fixed_uint rhs) noexcept
+		{
+			return internal::compare_limbs(lhs.to_limbs(), rhs.to_limbs());
+		}
+
+	private:
+		static constexpr std::errc parse(std::string_view text, fixed_uint& value) noexcept;
+
+		//least significant half first, so that on little-endian platforms the object has the same layout as its limb_array
+		int_part m_low;
+		int_part m_high;
+	};
+
+	/// <summary>
+	/// 256-bit unsigned integer.
+	/// </summary>
+	using uint256 = fixed_uint<uint128>;
+
+	/// <summary>
+	/// 512-bit unsigned integer.
+	/// </summary>
+	using uint512 = fixed_uint<uint256>;
+
+	/// <summary>
+	/// Writes value in base [2, 36] to [first, last) with the semantics of std::to_chars for the builtin
+	/// unsigned integers: no prefix, no padding, lowercase digits.
+	/// </summary>
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr std::to_chars_result to_chars(char* first, char* last, fixed_uint<LimbType> value, int base = 10) noexcept;
+
+	/// <summary>
+	/// Parses a fixed_uint from [first, last) with the semantics of std::from_chars for the builtin
+	/// unsigned integers: no sign, prefix or whitespace is accepted.
+	/// </summary>
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr std::from_chars_result from_chars(const char* first, const char* last, fixed_uint<LimbType>& value, int base = 10) noexcept;
+
+	/// <summary>
+	/// Honors the stream's basefield (dec, hex, oct), showbase, uppercase, width, fill and adjustfield.
+	/// </summary>
+	template<typename Char, typename CharTraits, concepts::cjm_unsigned_integer LimbType>
+		requires cjm::numerics::concepts::char_with_traits<Char, CharTraits>
+	std::basic_ostream<Char, CharTraits>& operator<<(std::basic_ostream<Char, CharTraits>& os, fixed_uint<LimbType> value);
+
+	/// <summary>
+	/// Extracts a whitespace-delimited token in any form accepted by fixed_uint::make_from_string;
+	/// sets failbit (and leaves value zero) if it cannot be parsed.
+	/// </summary>
+	template<typename Char, typename CharTraits, concepts::cjm_unsigned_integer LimbType>
+		requires cjm::numerics::concepts::char_or_wchar_t_with_traits<Char, CharTraits>
+	std::basic_istream<Char, CharTraits>& operator>>(std::basic_istream<Char, CharTraits>& is, fixed_uint<LimbType>& value);
+
+	namespace fixed_uint_literals
+	{
+		/************************************************************************/
+		/* Accepts decimal and hexadecimal literals (with ' separators), just like
+		 * _u128.  Binary literals are accepted if their value fits in 128 bits.
+		 * Out of range or illegal literals fail to compile.					*/
+		/************************************************************************/
+		template<char... Chars>
+			requires (sizeof...(Chars) > 0)
+		constexpr uint256 operator"" _u256();
+
+		template<char... Chars>
+			requires (sizeof...(Chars) > 0)
+		constexpr uint512 operator"" _u512();
+	}
+}
+#include <cjm/numerics/fixed_uint.inl>
+#endif
@@ -0,0 +1,1074 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_FIXED_UINT_INL_
+#define CJM_FIXED_UINT_INL_
+#include <cjm/numerics/fixed_uint.hpp>
+
+namespace cjm::numerics::internal
+{
+	template<typename Ui>
+	constexpr void store_u64_limbs(Ui value, std::uint64_t* dest) noexcept
+	{
+		if constexpr (std::is_same_v<Ui, std::uint64_t>)
+		{
+			*dest = value;
+		}
+		else
+		{
+			using half_t = typename Ui::int_part;
+			store_u64_limbs<half_t>(value.low_part(), dest);
+			store_u64_limbs<half_t>(value.high_part(), dest + u64_limb_count_v<half_t>);
+		}
+	}
+
+	template<typename Ui>
+	constexpr Ui load_u64_limbs(const std::uint64_t* src) noexcept
+	{
+		if constexpr (std::is_same_v<Ui, std::uint64_t>)
+		{
+			return *src;
+		}
+		else
+		{
+			using half_t = typename Ui::int_part;
+			return Ui{ load_u64_limbs<half_t>(src + u64_limb_count_v<half_t>), load_u64_limbs<half_t>(src) };
+		}
+	}
+
+	template<size_t LimbCount>
+	constexpr unsigned char add_limbs(u64_limbs<LimbCount>& augend, const u64_limbs<LimbCount>& addend) noexcept
+	{
+		unsigned char carry = 0;
+		for (size_t i = 0; i < LimbCount; ++i)
+		{
+			augend[i] = numerics::add_with_carry(augend[i], addend[i], carry, carry);
+		}
+		return carry;
+	}
+
+	template<size_t LimbCount>
+	constexpr unsigned char sub_limbs(u64_limbs<LimbCount>& minuend, const u64_limbs<LimbCount>& subtrahend) noexcept
+	{
+		unsigned char borrow = 0;
+		for (size_t i = 0; i < LimbCount; ++i)
+		{
+			minuend[i] = numerics::sub_with_borrow(minuend[i], subtrahend[i], borrow, borrow);
+		}
+		return borrow;
+	}
+
+	template<size_t LimbCount>
+	constexpr u64_limbs<LimbCount> multiply_limbs(const u64_limbs<LimbCount>& multiplicand,
+		const u64_limbs<LimbCount>& multiplier) noexcept
+	{
+		u64_limbs<LimbCount> product{};
+		for (size_t i = 0; i < LimbCount; ++i)
+		{
+			if (multiplicand[i] == 0)
+				continue;
+			std::uint64_t carry = 0;
+			for (size_t j = 0; i + j < LimbCount; ++j)
+			{
+				//at most (2^64 - 1)^2 + 2 * (2^64 - 1) == 2^128 - 1: cannot overflow
+				const uint128 partial = full_multiply_u64(multiplicand[i], multiplier[j])
+					+ product[i + j] + carry;
+				product[i + j] = partial.low_part();
+				carry = partial.high_part();
+			}
+		}
+		return product;
+	}
+
+	template<size_t LimbCount>
+	constexpr u64_limbs<LimbCount> shift_left_limbs(const u64_limbs<LimbCount>& limbs, int amount) noexcept
+	{
+		assert(amount > -1 && static_cast<size_t>(amount) < LimbCount * std::numeric_limits<std::uint64_t>::digits);
+		constexpr int limb_bits = std::numeric_limits<std::uint64_t>::digits;
+		const auto limb_shift = static_cast<size_t>(amount / limb_bits);
+		const int bit_shift = amount % limb_bits;
+		u64_limbs<LimbCount> ret{};
+		for (size_t i = LimbCount; i-- > limb_shift;)
+		{
+			const size_t source = i - limb_shift;
+			ret[i] = limbs[source] << bit_shift;
+			if (bit_shift != 0 && source != 0)
+			{
+				ret[i] |= limbs[source - 1] >> (limb_bits - bit_shift);
+			}
+		}
+		return ret;
+	}
+
+	template<size_t LimbCount>
+	constexpr u64_limbs<LimbCount> shift_right_limbs(const u64_limbs<LimbCount>& limbs, int amount) noexcept
+	{
+		assert(amount > -1 && static_cast<size_t>(amount) < LimbCount * std::numeric_limits<std::uint64_t>::digits);
+		constexpr int limb_bits = std::numeric_limits<std::uint64_t>::digits;
+		const auto limb_shift = static_cast<size_t>(amount / limb_bits);
+		const int bit_shift = amount % limb_bits;
+		u64_limbs<LimbCount> ret{};
+		for (size_t i = 0; i + limb_shift < LimbCount; ++i)
+		{
+			const size_t source = i + limb_shift;
+			ret[i] = limbs[source] >> bit_shift;
+			if (bit_shift != 0 && source + 1 < LimbCount)
+			{
+				ret[i] |= limbs[source + 1] << (limb_bits - bit_shift);
+			}
+		}
+		return ret;
+	}
+
+	template<size_t LimbCount>
+	constexpr std::strong_ordering compare_limbs(const u64_limbs<LimbCount>& lhs, const u64_limbs<LimbCount>& rhs) noexcept
+	{
+		for (size_t i = LimbCount; i-- > 0;)
+		{
+			if (lhs[i] != rhs[i])
+			{
+				return lhs[i] <=> rhs[i];
+			}
+		}
+		return std::strong_ordering::equal;
+	}
+
+	template<size_t LimbCount>
+	constexpr size_t significant_limbs(const u64_limbs<LimbCount>& limbs) noexcept
+	{
+		size_t count = LimbCount;
+		while (count != 0 && limbs[count - 1] == 0)
+		{
+			--count;
+		}
+		return count;
+	}
+
+	template<size_t LimbCount>
+	constexpr bool multiply_add_limbs_u64(u64_limbs<LimbCount>& limbs, std::uint64_t multiplier,
+		std::uint64_t addend) noexcept
+	{
+		std::uint64_t carry = addend;
+		for (auto& limb : limbs)
+		{
+			const uint128 partial = full_multiply_u64(limb, multiplier) + carry;
+			limb = partial.low_part();
+			carry = partial.high_part();
+		}
+		return carry == 0;
+	}
+
+	template<size_t LimbCount>
+	constexpr std::uint64_t div_mod_limbs_normalized_u64(u64_limbs<LimbCount>& limbs,
+		std::uint64_t normalized_divisor, std::uint64_t reciprocal, int shift) noexcept
+	{
+		constexpr int limb_bits = std::numeric_limits<std::uint64_t>::digits;
+		//the bits shifted out of the top limb start off the remainder: they are less than 2^shift <= normalized_divisor
+		std::uint64_t remainder = shift != 0 ? limbs[LimbCount - 1] >> (limb_bits - shift) : 0;
+		for (size_t i = LimbCount; i-- > 0;)
+		{
+			std::uint64_t low = limbs[i] << shift;
+			if (shift != 0 && i != 0)
+			{
+				low |= limbs[i - 1] >> (limb_bits - shift);
+			}
+			const auto [quotient, next_remainder] = div_mod_2by1_preinv(remainder, low, normalized_divisor, reciprocal);
+			limbs[i] = quotient;
+			remainder = next_remainder;
+		}
+		return remainder >> shift;
+	}
+
+	template<size_t LimbCount>
+	constexpr std::uint64_t div_mod_limbs_u64(u64_limbs<LimbCount>& limbs, std::uint64_t divisor) noexcept
+	{
+		assert(divisor != 0);
+#if defined(CJM_UDIV_INTRINSIC_AVAILABLE) || defined(CJM_GNU_X64_ASM_DIVQ_AVAILABLE)
+		if (!std::is_constant_evaluated())
+		{
+			//the remainder carried into each step is less than the divisor, so the instruction never faults
+			std::uint64_t remainder = 0;
+			for (size_t i = LimbCount; i-- > 0;)
+			{
+#ifdef CJM_UDIV_INTRINSIC_AVAILABLE
+				limbs[i] = CJM_UDIV128(remainder, limbs[i], divisor, &remainder);
+#else
+				const auto [quotient, next_remainder] = div_mod_2by1_divq(remainder, limbs[i], divisor);
+				limbs[i] = quotient;
+				remainder = next_remainder;
+#endif
+			}
+			return remainder;
+		}
+#endif
+		const int shift = std::countl_zero(divisor);
+		const std::uint64_t normalized_divisor = divisor << shift;
+		return div_mod_limbs_normalized_u64(limbs, normalized_divisor, reciprocal_2by1(normalized_divisor), shift);
+	}
+
+	template<size_t LimbCount>
+	constexpr void div_mod_limbs(const u64_limbs<LimbCount>& dividend, const u64_limbs<LimbCount>& divisor,
+		u64_limbs<LimbCount>& quotient, u64_limbs<LimbCount>& remainder) noexcept
+	{
+		constexpr int limb_bits = std::numeric_limits<std::uint64_t>::digits;
+		const size_t divisor_limbs = significant_limbs(divisor);
+		assert(divisor_limbs != 0);
+		quotient = u64_limbs<LimbCount>{};
+		if (compare_limbs(dividend, divisor) == std::strong_ordering::less)
+		{
+			remainder = dividend;
+			return;
+		}
+		if (divisor_limbs == 1)
+		{
+			quotient = dividend;
+			remainder = u64_limbs<LimbCount>{};
+			remainder[0] = div_mod_limbs_u64(quotient, divisor[0]);
+			return;
+		}
+		const size_t dividend_limbs = significant_limbs(dividend);
+
+		//D1: normalize so the divisor's top limb has its high bit set; the dividend gains a limb
+		const int shift = std::countl_zero(divisor[divisor_limbs - 1]);
+		const u64_limbs<LimbCount> v = shift_left_limbs(divisor, shift);
+		std::array<std::uint64_t, LimbCount + 1> u{};
+		u[LimbCount] = shift != 0 ? dividend[LimbCount - 1] >> (limb_bits - shift) : 0;
+		for (size_t i = LimbCount; i-- > 0;)
+		{
+			u[i] = dividend[i] << shift;
+			if (shift != 0 && i != 0)
+			{
+				u[i] |= dividend[i - 1] >> (limb_bits - shift);
+			}
+		}
+
+		const std::uint64_t divisor_top = v[divisor_limbs - 1];
+		const std::uint64_t divisor_next = v[divisor_limbs - 2];
+		const std::uint64_t reciprocal = reciprocal_2by1(divisor_top);
+		for (size_t j = dividend_limbs - divisor_limbs + 1; j-- > 0;)
+		{
+			//D3: estimate the quotient limb from the top two limbs, then refine it with the third
+			std::uint64_t estimate;
+			uint128 estimate_remainder;
+			if (u[j + divisor_limbs] >= divisor_top)
+			{
+				estimate = std::numeric_limits<std::uint64_t>::max();
+				estimate_remainder = uint128::make_uint128(u[j + divisor_limbs], u[j + divisor_limbs - 1])
+					- full_multiply_u64(estimate, divisor_top);
+			}
+			else
+			{
+				const auto [q, r] = div_mod_2by1_preinv(u[j + divisor_limbs], u[j + divisor_limbs - 1],
+					divisor_top, reciprocal);
+				estimate = q;
+				estimate_remainder = r;
+			}
+			while (estimate_remainder.high_part() == 0 && full_multiply_u64(estimate, divisor_next)
+				> uint128::make_uint128(estimate_remainder.low_part(), u[j + divisor_limbs - 2]))
+			{
+				--estimate;
+				estimate_remainder += divisor_top;
+			}
+
+			//D4: multiply and subtract
+			std::uint64_t carry = 0;
+			unsigned char borrow = 0;
+			for (size_t i = 0; i < divisor_limbs; ++i)
+			{
+				const uint128 product = full_multiply_u64(estimate, v[i]) + carry;
+				carry = product.high_part();
+				u[i + j] = numerics::sub_with_borrow(u[i + j], product.low_part(), borrow, borrow);
+			}
+			u[j + divisor_limbs] = numerics::sub_with_borrow(u[j + divisor_limbs], carry, borrow, borrow);
+
+			//D6: the estimate was still one too large (rare): add the divisor back
+			if (borrow != 0)
+			{
+				--estimate;
+				unsigned char add_carry = 0;
+				for (size_t i = 0; i < divisor_limbs; ++i)
+				{
+					u[i + j] = numerics::add_with_carry(u[i + j], v[i], add_carry, add_carry);
+				}
+				u[j + divisor_limbs] += add_carry;
+			}
+			quotient[j] = estimate;
+		}
+
+		//D8: unnormalize the remainder
+		remainder = u64_limbs<LimbCount>{};
+		for (size_t i = 0; i < divisor_limbs; ++i)
+		{
+			remainder[i] = u[i] >> shift;
+			if (shift != 0)
+			{
+				remainder[i] |= u[i + 1] << (limb_bits - shift);
+			}
+		}
+	}
+
+	template<size_t LimbCount>
+	constexpr char* write_limbs_digits_backward(char* end, u64_limbs<LimbCount> limbs, int base) noexcept
+	{
+		const radix_chunk& chunk = radix_chunks[static_cast<size_t>(base)];
+		const auto radix = static_cast<std::uint64_t>(base);
+		//peel off full-width chunks until what remains fits in a single limb
+		while (significant_limbs(limbs) > 1)
+		{
+			const std::uint64_t remainder = div_mod_limbs_normalized_u64(limbs, chunk.divisor << chunk.shift,
+				chunk.reciprocal, chunk.shift);
+			end = write_u64_digits_backward(end, remainder, radix, chunk.digits);
+		}
+		return write_u64_digits_backward(end, limbs[0], radix, 1);
+	}
+
+	template<size_t LimbCount>
+	constexpr std::from_chars_result parse_limbs_digits(const char* first, const char* last,
+		u64_limbs<LimbCount>& limbs, int base) noexcept
+	{
+		const radix_chunk& chunk = radix_chunks[static_cast<size_t>(base)];
+		const auto radix = static_cast<unsigned>(base);
+		u64_limbs<LimbCount> result{};
+		bool overflowed = false;
+		const char* pos = first;
+		//digits are gathered a limb's worth at a time: one multiply-add pass per chunk rather than per digit
+		while (pos != last)
+		{
+			const char* const chunk_end = last - pos > chunk.digits ? pos + chunk.digits : last;
+			const char* const chunk_begin = pos;
+			std::uint64_t digits = 0;
+			std::uint64_t scale = 1;
+			for (unsigned digit; pos != chunk_end && (digit = digit_value(*pos)) < radix; ++pos)
+			{
+				digits = digits * radix + digit;
+				scale *= radix;
+			}
+			if (pos == chunk_begin)
+			{
+				break;
+			}
+			overflowed = !multiply_add_limbs_u64(result, scale, digits) || overflowed;
+			if (pos != chunk_end)
+			{
+				break;
+			}
+		}
+		if (pos == first)
+		{
+			return std::from_chars_result{ first, std::errc::invalid_argument };
+		}
+		if (overflowed)
+		{
+			return std::from_chars_result{ pos, std::errc::result_out_of_range };
+		}
+		limbs = result;
+		return std::from_chars_result{ pos, std::errc{} };
+	}
+}
+
+namespace cjm::numerics
+{
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType> fixed_uint<LimbType>::make_from_string(std::string_view text)
+	{
+		fixed_uint ret{};
+		const std::errc error = parse(text, ret);
+		if (error == std::errc::result_out_of_range)
+		{
+			throw std::overflow_error{ "The value is too large to fit in this type." };
+		}
+		if (error != std::errc{})
+		{
+			throw std::invalid_argument{ "The text is not a decimal or 0x-prefixed hexadecimal number." };
+		}
+		return ret;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr std::optional<fixed_uint<LimbType>> fixed_uint<LimbType>::try_make_from_string(
+		std::string_view text) noexcept
+	{
+		fixed_uint ret{};
+		if (parse(text, ret) != std::errc{})
+		{
+			return std::nullopt;
+		}
+		return ret;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr std::errc fixed_uint<LimbType>::parse(std::string_view text, fixed_uint& value) noexcept
+	{
+		constexpr std::string_view whitespace = " \t\n\v\f\r";
+		const auto first_non_space = text.find_first_not_of(whitespace);
+		if (first_non_space == std::string_view::npos)
+		{
+			return std::errc::invalid_argument;
+		}
+		text = text.substr(first_non_space, text.find_last_not_of(whitespace) - first_non_space + 1);
+		int base = 10;
+		if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+		{
+			base = 16;
+			text.remove_prefix(2);
+		}
+		const char* const last = text.data() + text.size();
+		const auto [ptr, ec] = from_chars(text.data(), last, value, base);
+		if (ec == std::errc{} && ptr != last)
+		{
+			value = 0;
+			return std::errc::invalid_argument;
+		}
+		return ec;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType> fixed_uint<LimbType>::make_from_bytes_little_endian(byte_array bytes) noexcept
+	{
+		limb_array limbs{};
+		for (size_t i = 0; i < bytes.size(); ++i)
+		{
+			limbs[i / sizeof(std::uint64_t)] |= static_cast<std::uint64_t>(bytes[i]) << (CHAR_BIT * (i % sizeof(std::uint64_t)));
+		}
+		return make_from_limbs(limbs);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType> fixed_uint<LimbType>::make_from_bytes_big_endian(byte_array bytes) noexcept
+	{
+		std::reverse(bytes.begin(), bytes.end());
+		return make_from_bytes_little_endian(bytes);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType> fixed_uint<LimbType>::make_fixed_uint(int_part high, int_part low) noexcept
+	{
+		return fixed_uint{ high, low };
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType> fixed_uint<LimbType>::make_from_limbs(const limb_array& limbs) noexcept
+	{
+		return fixed_uint{ internal::load_u64_limbs<int_part>(limbs.data() + limb_count / 2),
+			internal::load_u64_limbs<int_part>(limbs.data()) };
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr std::optional<typename fixed_uint<LimbType>::divmod_result_t> fixed_uint<LimbType>::try_div_mod(
+		fixed_uint dividend, fixed_uint divisor) noexcept
+	{
+		if (divisor == 0)
+		{
+			return std::nullopt;
+		}
+		return unsafe_div_mod(dividend, divisor);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr typename fixed_uint<LimbType>::divmod_result_t fixed_uint<LimbType>::div_mod(fixed_uint dividend,
+		fixed_uint divisor)
+	{
+		if (divisor == 0)
+		{
+			throw std::domain_error("Division and/or modulus by zero is forbidden.");
+		}
+		return unsafe_div_mod(dividend, divisor);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr typename fixed_uint<LimbType>::divmod_result_t fixed_uint<LimbType>::unsafe_div_mod(
+		fixed_uint dividend, fixed_uint divisor) noexcept
+	{
+		assert(divisor != 0);
+		if (dividend.m_high == 0 && divisor.m_high == 0)
+		{
+			//both fit in the narrower type, which has its own (faster) division
+			const auto [quotient, remainder] = int_part::unsafe_div_mod(dividend.m_low, divisor.m_low);
+			return divmod_result_t{ quotient, remainder };
+		}
+		limb_array quotient{};
+		limb_array remainder{};
+		internal::div_mod_limbs(dividend.to_limbs(), divisor.to_limbs(), quotient, remainder);
+		return divmod_result_t{ make_from_limbs(quotient), make_from_limbs(remainder) };
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr int fixed_uint<LimbType>::most_sign_set_bit(fixed_uint value) noexcept
+	{
+		assert(value != 0);
+		const limb_array limbs = value.to_limbs();
+		const size_t top = internal::significant_limbs(limbs) - 1;
+		return static_cast<int>(top) * std::numeric_limits<std::uint64_t>::digits
+			+ (std::numeric_limits<std::uint64_t>::digits - 1 - std::countl_zero(limbs[top]));
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>::fixed_uint(int_part high, int_part low) noexcept
+		: m_low{ low }, m_high{ high } {}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>::fixed_uint(int_part low) noexcept
+		: m_low{ low }, m_high{} {}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	template<concepts::builtin_integer Integer>
+	constexpr fixed_uint<LimbType>::fixed_uint(Integer value) noexcept
+		: m_low{ value }, m_high{}
+	{
+		if constexpr (std::is_signed_v<Integer>)
+		{
+			if (value < 0)
+			{
+				m_high = ~int_part{};
+			}
+		}
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	template<internal::narrower_cjm_unsigned_integer<fixed_uint<LimbType>> Ui>
+	constexpr fixed_uint<LimbType>::fixed_uint(Ui value) noexcept
+		: m_low{}, m_high{}
+	{
+		limb_array limbs{};
+		internal::store_u64_limbs(value, limbs.data());
+		*this = make_from_limbs(limbs);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	template<concepts::builtin_floating_point TFloat>
+	fixed_uint<LimbType>::fixed_uint(TFloat value) noexcept
+		: m_low{}, m_high{}
+	{
+		assert(value >= 0 && value < std::ldexp(static_cast<TFloat>(1), std::numeric_limits<fixed_uint>::digits));
+		constexpr int limb_bits = std::numeric_limits<std::uint64_t>::digits;
+		limb_array limbs{};
+		//most significant limb first: each subtraction leaves an exactly representable remainder
+		for (size_t i = limb_count; value >= 1 && i-- > 0;)
+		{
+			const TFloat scaled = std::ldexp(value, -limb_bits * static_cast<int>(i));
+			if (scaled >= 1)
+			{
+				limbs[i] = static_cast<std::uint64_t>(scaled);
+				value -= std::ldexp(static_cast<TFloat>(limbs[i]), limb_bits * static_cast<int>(i));
+			}
+		}
+		*this = make_from_limbs(limbs);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>::operator bool() const noexcept
+	{
+		return static_cast<bool>(m_low) || static_cast<bool>(m_high);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	template<typename Integer>
+		requires (std::is_integral_v<Integer> && !std::is_same_v<Integer, bool> && concepts::builtin_integer<Integer>)
+	constexpr fixed_uint<LimbType>::operator Integer() const noexcept
+	{
+		const limb_array limbs = to_limbs();
+		if constexpr (sizeof(Integer) > sizeof(std::uint64_t))
+		{
+			using unsigned_t = std::make_unsigned_t<Integer>;
+			return static_cast<Integer>((static_cast<unsigned_t>(limbs[1]) << std::numeric_limits<std::uint64_t>::digits)
+				| static_cast<unsigned_t>(limbs[0]));
+		}
+		else
+		{
+			return static_cast<Integer>(limbs[0]);
+		}
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	template<typename Ui>
+		requires (std::is_same_v<Ui, LimbType> || internal::narrower_cjm_unsigned_integer<Ui, fixed_uint<LimbType>>)
+	constexpr fixed_uint<LimbType>::operator Ui() const noexcept
+	{
+		if constexpr (std::is_same_v<Ui, int_part>)
+		{
+			return m_low;
+		}
+		else
+		{
+			return internal::load_u64_limbs<Ui>(to_limbs().data());
+		}
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	template<concepts::builtin_floating_point TFloat>
+	fixed_uint<LimbType>::operator TFloat() const
+	{
+		constexpr int limb_bits = std::numeric_limits<std::uint64_t>::digits;
+		const limb_array limbs = to_limbs();
+		TFloat ret = 0;
+		for (size_t i = limb_count; i-- > 0;)
+		{
+			ret += std::ldexp(static_cast<TFloat>(limbs[i]), limb_bits * static_cast<int>(i));
+		}
+		return ret;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr typename fixed_uint<LimbType>::int_part fixed_uint<LimbType>::low_part() const noexcept
+	{
+		return m_low;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr typename fixed_uint<LimbType>::int_part fixed_uint<LimbType>::high_part() const noexcept
+	{
+		return m_high;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr typename fixed_uint<LimbType>::limb_array fixed_uint<LimbType>::to_limbs() const noexcept
+	{
+		limb_array ret{};
+		internal::store_u64_limbs(m_low, ret.data());
+		internal::store_u64_limbs(m_high, ret.data() + limb_count / 2);
+		return ret;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr typename fixed_uint<LimbType>::byte_array fixed_uint<LimbType>::to_little_endian_arr() const noexcept
+	{
+		const limb_array limbs = to_limbs();
+		byte_array ret{};
+		for (size_t i = 0; i < ret.size(); ++i)
+		{
+			ret[i] = static_cast<unsigned char>(limbs[i / sizeof(std::uint64_t)] >> (CHAR_BIT * (i % sizeof(std::uint64_t))));
+		}
+		return ret;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr typename fixed_uint<LimbType>::byte_array fixed_uint<LimbType>::to_big_endian_arr() const noexcept
+	{
+		byte_array ret = to_little_endian_arr();
+		std::reverse(ret.begin(), ret.end());
+		return ret;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr size_t fixed_uint<LimbType>::hash_code() const noexcept
+	{
+		static_assert(sizeof(size_t) == 8 || sizeof(size_t) == 4, "Only 32 and 64 bit architecture supported.");
+		size_t hash{ 0 };
+#ifdef CJM_NUMERICS_UINT128_LEGACY_HASH
+		for (const std::uint64_t limb : to_limbs())
+		{
+			if constexpr (sizeof(size_t) == 8)
+			{
+				hash = static_cast<size_t>(limb) + 0x9e37'79b9 + (hash << 6) + (hash >> 2);
+			}
+			else
+			{
+				hash ^= static_cast<size_t>(limb) + 0x9e37'79b9 + (hash << 6) + (hash >> 2);
+				hash ^= static_cast<size_t>(limb >> 32) + 0x9e37'79b9 + (hash << 6) + (hash >> 2);
+			}
+		}
+#else
+		//each 128-bit chunk, least significant first, goes through uint128's multiply-fold mixer
+		//with the hash of the chunks before it folded into its high limb
+		const limb_array limbs = to_limbs();
+		for (size_t i = 0; i < limbs.size(); i += 2)
+		{
+			hash = uint128::make_uint128(limbs[i + 1] ^ static_cast<std::uint64_t>(hash), limbs[i]).hash_code();
+		}
+#endif
+		return hash;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator+=(fixed_uint other) noexcept
+	{
+		limb_array limbs = to_limbs();
+		internal::add_limbs(limbs, other.to_limbs());
+		return *this = make_from_limbs(limbs);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator-=(fixed_uint other) noexcept
+	{
+		limb_array limbs = to_limbs();
+		internal::sub_limbs(limbs, other.to_limbs());
+		return *this = make_from_limbs(limbs);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator*=(fixed_uint other) noexcept
+	{
+		return *this = make_from_limbs(internal::multiply_limbs(to_limbs(), other.to_limbs()));
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator/=(fixed_uint other)
+	{
+		return *this = div_mod(*this, other).quotient;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator%=(fixed_uint other)
+	{
+		return *this = div_mod(*this, other).remainder;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator&=(fixed_uint other) noexcept
+	{
+		m_low &= other.m_low;
+		m_high &= other.m_high;
+		return *this;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator|=(fixed_uint other) noexcept
+	{
+		m_low |= other.m_low;
+		m_high |= other.m_high;
+		return *this;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator^=(fixed_uint other) noexcept
+	{
+		m_low ^= other.m_low;
+		m_high ^= other.m_high;
+		return *this;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator<<=(int amount) noexcept
+	{
+		//It is undefined behavior to attempt a shift greater than number of bits in an integral type
+		assert(amount > -1 && amount < std::numeric_limits<fixed_uint>::digits);
+		return *this = make_from_limbs(internal::shift_left_limbs(to_limbs(), amount));
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator>>=(int amount) noexcept
+	{
+		assert(amount > -1 && amount < std::numeric_limits<fixed_uint>::digits);
+		return *this = make_from_limbs(internal::shift_right_limbs(to_limbs(), amount));
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator<<=(unsigned amount) noexcept
+	{
+		return *this <<= static_cast<int>(amount);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator>>=(unsigned amount) noexcept
+	{
+		return *this >>= static_cast<int>(amount);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator<<=(fixed_uint amount) noexcept
+	{
+		assert(amount < std::numeric_limits<fixed_uint>::digits);
+		return *this <<= static_cast<int>(amount);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator>>=(fixed_uint amount) noexcept
+	{
+		assert(amount < std::numeric_limits<fixed_uint>::digits);
+		return *this >>= static_cast<int>(amount);
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator++() noexcept
+	{
+		return *this += 1;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType>& fixed_uint<LimbType>::operator--() noexcept
+	{
+		return *this -= 1;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType> fixed_uint<LimbType>::operator++(int) noexcept
+	{
+		const fixed_uint ret = *this;
+		++*this;
+		return ret;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr fixed_uint<LimbType> fixed_uint<LimbType>::operator--(int) noexcept
+	{
+		const fixed_uint ret = *this;
+		--*this;
+		return ret;
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr std::to_chars_result to_chars(char* first, char* last, fixed_uint<LimbType> value, int base) noexcept
+	{
+		if (base < 2 || base > 36)
+		{
+			return std::to_chars_result{ last, std::errc::invalid_argument };
+		}
+		std::array<char, std::numeric_limits<fixed_uint<LimbType>>::digits> buffer{};
+		char* const end = buffer.data() + buffer.size();
+		char* const begin = internal::write_limbs_digits_backward(end, value.to_limbs(), base);
+		const auto length = end - begin;
+		if (last - first < length)
+		{
+			return std::to_chars_result{ last, std::errc::value_too_large };
+		}
+		return std::to_chars_result{ std::copy(begin, end, first), std::errc{} };
+	}
+
+	template<concepts::cjm_unsigned_integer LimbType>
+	constexpr std::from_chars_result from_chars(const char* first, const char* last, fixed_uint<LimbType>& value, int base) noexcept
+	{
+		if (base < 2 || base > 36)
+		{
+			return std::from_chars_result{ first, std::errc::invalid_argument };
+		}
+		typename fixed_uint<LimbType>::limb_array limbs{};
+		const auto result = internal::parse_limbs_digits(first, last, limbs, base);
+		if (result.ec == std::errc{})
+		{
+			value = fixed_uint<LimbType>::make_from_limbs(limbs);
+		}
+		return result;
+	}
+
+	template<typename Char, typename CharTraits, concepts::cjm_unsigned_integer LimbType>
+		requires cjm::numerics::concepts::char_with_traits<Char, CharTraits>
+	std::basic_ostream<Char, CharTraits>& operator<<(std::basic_ostream<Char, CharTraits>& os, fixed_uint<LimbType> value)
+	{
+		using ios = std::basic_ios<Char, CharTraits>;
+		using iosflags = typename ios::fmtflags;
+		typename std::basic_ostream<Char, CharTraits>::sentry sentry{ os };
+		if (!sentry)
+			return os;
+		const iosflags flags = os.flags();
+		const bool show_base = (flags & ios::showbase) && value != 0;
+		const bool upper_case = static_cast<bool>(flags & ios::uppercase);
+		//binary is the longest representation we never produce, so there is always room for a prefix
+		constexpr size_t max_chars = std::numeric_limits<fixed_uint<LimbType>>::digits;
+		std::array<char, max_chars> narrow{};
+		char* const end = narrow.data() + narrow.size();
+		char* begin;
+		switch (flags & ios::basefield)
+		{
+		case ios::hex:
+			begin = internal::write_limbs_digits_backward(end, value.to_limbs(), 16);
+			if (upper_case)
+			{
+				std::transform(begin, end, begin, [](char c) -> char
+				{
+					return c >= 'a' && c <= 'f' ? static_cast<char>(c - 'a' + 'A') : c;
+				});
+			}
+			if (show_base)
+			{
+				*--begin = upper_case ? 'X' : 'x';
+				*--begin = '0';
+			}
+			break;
+		case ios::oct:
+			begin = internal::write_limbs_digits_backward(end, value.to_limbs(), 8);
+			if (show_base)
+			{
+				*--begin = '0';
+			}
+			break;
+		default:  // std::ios::dec
+			begin = internal::write_limbs_digits_backward(end, value.to_limbs(), 10);
+			break;
+		}
+		std::array<Char, max_chars> rep{};
+		std::transform(begin, end, rep.begin(), [](char c) -> Char { return static_cast<Char>(c); });
+		const auto rep_size = static_cast<std::streamsize>(end - begin);
+
+		std::streamsize width = os.width(0);
+		std::streamsize fill_before = 0;
+		std::streamsize prefix_size = 0;
+		std::streamsize fill_after_prefix = 0;
+		std::streamsize fill_after = 0;
+		if (width > rep_size)
+		{
+			const std::streamsize width_less_size = width - rep_size;
+			iosflags adjustfield = flags & ios::adjustfield;
+			if (adjustfield == ios::left)
+			{
+				fill_after = width_less_size;
+			}
+			else if (adjustfield == ios::internal && show_base && (flags & ios::basefield) == ios::hex)
+			{
+				prefix_size = 2;
+				fill_after_prefix = width_less_size;
+			}
+			else
+			{
+				fill_before = width_less_size;
+			}
+		}
+
+		auto* const buffer = os.rdbuf();
+		//only consult fill when padding: it requires a ctype facet the utf streams may lack
+		auto put_fill = [buffer, &os](std::streamsize count) -> bool
+		{
+			const Char fill = count > 0 ? os.fill() : Char{};
+			for (; count > 0; --count)
+			{
+				if (CharTraits::eq_int_type(buffer->sputc(fill), CharTraits::eof()))
+					return false;
+			}
+			return true;
+		};
+		const bool written = put_fill(fill_before)
+			&& buffer->sputn(rep.data(), prefix_size) == prefix_size
+			&& put_fill(fill_after_prefix)
+			&& buffer->sputn(rep.data() + prefix_size, rep_size - prefix_size) == rep_size - prefix_size
+			&& put_fill(fill_after);
+		if (!written)
+		{
+			os.setstate(std::ios_base::badbit);
+		}
+		return os;
+	}
+
+	template<typename Char, typename CharTraits, concepts::cjm_unsigned_integer LimbType>
+		requires cjm::numerics::concepts::char_or_wchar_t_with_traits<Char, CharTraits>
+	std::basic_istream<Char, CharTraits>& operator>>(std::basic_istream<Char, CharTraits>& is, fixed_uint<LimbType>& value)
+	{
+		value = 0;
+		std::basic_string<Char, CharTraits> token;
+		if (!(is >> token))
+		{
+			return is;
+		}
+		//anything outside ascii cannot be part of a number
+		std::string narrow;
+		narrow.reserve(token.size());
+		for (const Char c : token)
+		{
+			const auto code = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<Char>>(c));
+			narrow.push_back(code < 0x80u ? static_cast<char>(code) : '\0');
+		}
+		if (const auto parsed = fixed_uint<LimbType>::try_make_from_string(narrow); parsed.has_value())
+		{
+			value = *parsed;
+		}
+		else
+		{
+			is.setstate(std::ios_base::failbit);
+		}
+		return is;
+	}
+
+	namespace fixed_uint_literals
+	{
+		template<char... Chars>
+			requires (sizeof...(Chars) > 0)
+		constexpr uint256 operator"" _u256()
+		{
+			constexpr std::optional<uint256> result = uint128_literals::lit_helper::parse_literal<uint256,
+				Chars...>();
+			static_assert(result.has_value(), "This literal is not a valid decimal, hexadecimal or binary uint256.");
+			return *result;
+		}
+
+		template<char... Chars>
+			requires (sizeof...(Chars) > 0)
+		constexpr uint512 operator"" _u512()
+		{
+			constexpr std::optional<uint512> result = uint128_literals::lit_helper::parse_literal<uint512,
+				Chars...>();
+			static_assert(result.has_value(), "This literal is not a valid decimal, hexadecimal or binary uint512.");
+			return *result;
+		}
+	}
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr size_t std::hash<cjm::numerics::fixed_uint<LimbType>>::operator()(
+	const cjm::numerics::fixed_uint<LimbType>& key_val) const noexcept
+{
+	return key_val.hash_code();
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::min() noexcept
+{
+	return 0;
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::lowest() noexcept
+{
+	return 0;
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::max() noexcept
+{
+	return cjm::numerics::fixed_uint<LimbType>{ std::numeric_limits<LimbType>::max(), std::numeric_limits<LimbType>::max() };
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::epsilon() noexcept
+{
+	return 0;
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::round_error() noexcept
+{
+	return 0;
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::infinity() noexcept
+{
+	return 0;
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::quiet_NaN() noexcept
+{
+	return 0;
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::signaling_NaN() noexcept
+{
+	return 0;
+}
+
+template<cjm::numerics::concepts::cjm_unsigned_integer LimbType>
+constexpr cjm::numerics::fixed_uint<LimbType> std::numeric_limits<cjm::numerics::fixed_uint<LimbType>>::denorm_min() noexcept
+{
+	return 0;
+}
+
+namespace cjm::numerics
+{
+	static_assert(concepts::cjm_unsigned_integer<uint256>, "Needs to comply with cjm_unsigned_integer concept.");
+	static_assert(concepts::cjm_unsigned_integer<uint512>, "Needs to comply with cjm_unsigned_integer concept.");
+}
+#endif
@@ -0,0 +1,367 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_INT128_HPP_
+#define CJM_INT128_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#if __has_include(<format>)
+#include <format>
+#endif
+
+namespace std
+{
+	template<>
+	struct hash<cjm::numerics::int128> final
+	{
+		constexpr hash() noexcept = default;
+		constexpr size_t operator()(const cjm::numerics::int128& key_val) const noexcept;
+	};
+
+	/************************************************************************/
+	/* Defines numeric limits and various traits for int128
+	* to facilitate interoperability with code that relies on these traits.  */
+	/************************************************************************/
+	template<>
+	class numeric_limits<cjm::numerics::int128> final
+	{
+	public:
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = true;
+		static constexpr bool is_integer{ true };
+		static constexpr bool is_exact = true;
+		static constexpr bool is_bounded = true;
+		static constexpr bool has_denorm = std::denorm_absent;
+		static constexpr bool has_infinity = false;
+		static constexpr bool has_quiet_NaN = std::numeric_limits<int64_t>::has_quiet_NaN;
+		static constexpr bool has_signaling_NaN = std::numeric_limits<int64_t>::has_signaling_NaN;
+		static constexpr bool has_denorm_loss = std::numeric_limits<int64_t>::has_denorm_loss;
+		static constexpr std::float_round_style round_style = std::numeric_limits<int64_t>::round_style;
+		static constexpr bool is_arithmetic = true;
+		static constexpr bool is_iec559 = std::numeric_limits<int64_t>::is_iec559;
+		//overflow wraps (as it does for uint128) rather than being undefined
+		static constexpr bool is_modulo = true;
+		static constexpr int digits = std::numeric_limits<uint64_t>::digits * 2 - 1;
+		static constexpr int digits10 = digits * 301'299 / 1'000'000;
+		static constexpr int max_digits10 = std::numeric_limits<int64_t>::max_digits10;
+		static constexpr int radix = 2;
+		static constexpr int min_exponent = 0;
+		static constexpr int max_exponent = 0;
+		static constexpr int min_exponent10 = 0;
+		static constexpr int max_exponent10 = 0;
+		static constexpr bool traps = true;
+
+		static constexpr cjm::numerics::int128 min() noexcept;
+
+		static constexpr cjm::numerics::int128 lowest() noexcept;
+
+		static constexpr cjm::numerics::int128 max() noexcept;
+
+		static constexpr cjm::numerics::int128 epsilon() noexcept;
+
+		static constexpr cjm::numerics::int128 round_error() noexcept;
+
+		static constexpr cjm::numerics::int128 infinity() noexcept;
+
+		static constexpr cjm::numerics::int128 quiet_NaN() noexcept;
+
+		static constexpr cjm::numerics::int128 signaling_NaN() noexcept;
+
+		static constexpr cjm::numerics::int128 denorm_min() noexcept;
+	};
+
+#ifdef __cpp_lib_format
+	/************************************************************************/
+	/* Lets std::format write int128s directly to its output with the same
+	 * format spec as uint128.  As with the builtin signed integers, negative
+	 * values are written as a '-' followed by the magnitude in every base.	*/
+	/************************************************************************/
+	template<typename Char>
+	struct formatter<cjm::numerics::int128, Char>
+	{
+		constexpr typename basic_format_parse_context<Char>::iterator parse(basic_format_parse_context<Char>& ctx);
+
+		template<typename FormatContext>
+		typename FormatContext::iterator format(cjm::numerics::int128 value, FormatContext& ctx) const;
+
+	private:
+		cjm::numerics::internal::u128_format_spec<Char> m_spec{};
+	};
+#endif
+}
+
+namespace cjm::numerics
+{
+	/************************************************************************/
+	/* A signed, two's complement 128-bit integer.
+	 *
+	 * It stores its value as the bits of a uint128, so addition, subtraction,
+	 * multiplication, left shifts and the bitwise operators are exactly uint128's
+	 * (and use whatever native type or intrinsics uint128 uses).  The operations
+	 * where signedness matters -- comparison, right shift (which is arithmetic),
+	 * division and modulus (which truncate toward zero) -- use the compiler's
+	 * native __int128 at runtime where it is available, MSVC x64 intrinsics where
+	 * they help and portable arithmetic on the halves otherwise and in constant
+	 * evaluation.
+	 *
+	 * Overflow wraps, as it does for uint128: in particular, -min() and
+	 * min() / -1 are min().  Use the checked_* functions to detect overflow
+	 * or the saturating_* functions to clamp instead.  Division or modulus by
+	 * zero throws std::domain_error.
+	 *
+	 * The literal suffix is _i128 (namespace cjm::numerics::int128_literals);
+	 * as with the builtin types, a negative literal is the negation of a
+	 * positive one, so min() itself cannot be written as a literal.
+	 *																		*/
+	/************************************************************************/
+	class int128 final
+	{
+	public:
+		using int_part = std::uint64_t;
+		using unsigned_type = uint128;
+		static constexpr size_t byte_array_size = uint128::byte_array_size;
+		using byte_array = uint128::byte_array;
+		using divmod_result_t = divmod_result<int128>;
+
+		/// <summary>
+		/// Parses an optionally signed ('-' or '+') decimal or 0x-prefixed hexadecimal
+		/// magnitude (surrounding whitespace is ignored).
+		/// </summary>
+		/// <exception cref="std::invalid_argument">text is not in that form.</exception>
+		/// <exception cref="std::overflow_error">the value does not fit in an int128.</exception>
+		static constexpr int128 make_from_string(std::string_view text);
+
+		/// <summary>
+		/// Parses text accepted by make_from_string without throwing.
+		/// </summary>
+		/// <returns>the value, or std::nullopt if text cannot be parsed into an int128.</returns>
+		static constexpr std::optional<int128> try_make_from_string(std::string_view text) noexcept;
+
+		static constexpr int128 make_from_bytes_little_endian(byte_array bytes) noexcept;
+		static constexpr int128 make_from_bytes_big_endian(byte_array bytes) noexcept;
+		static constexpr int128 make_int128(std::int64_t high, std::uint64_t low) noexcept;
+
+		/// <summary>
+		/// Truncating division: the quotient is rounded toward zero and the remainder
+		/// has the sign of the dividend, as with the builtin signed integers.
+		/// </summary>
+		/// <returns>std::nullopt if divisor is zero.</returns>
+		static constexpr std::optional<divmod_result_t> try_div_mod(int128 dividend, int128 divisor) noexcept;
+
+		/// <summary>
+		/// As try_div_mod.
+		/// </summary>
+		/// <exception cref="std::domain_error">divisor is zero.</exception>
+		static constexpr divmod_result_t div_mod(int128 dividend, int128 divisor);
+
+		/// <summary>
+		/// As try_div_mod, but divisor must not be zero.
+		/// </summary>
+		static constexpr divmod_result_t unsafe_div_mod(int128 dividend, int128 divisor) noexcept;
+
+		constexpr int128() noexcept : m_value{} {}
+		constexpr int128(const int128& other) noexcept = default;
+		constexpr int128(int128&& other) noexcept = default;
+		constexpr int128& operator=(const int128& other) noexcept = default;
+		constexpr int128& operator=(int128&& other) noexcept = default;
+		constexpr ~int128() noexcept = default;
+		constexpr explicit int128(std::int64_t high, std::uint64_t low) noexcept;
+
+		//reinterprets the bits of a uint128 (values above max() become negative)
+		constexpr explicit int128(uint128 bits) noexcept : m_value{ bits } {}
+
+		//from the builtin integers: signed values are sign-extended, unsigned values zero-extended
+		template<concepts::builtin_integer Integer>
+		constexpr int128(Integer value) noexcept;
+
+		template<concepts::builtin_floating_point TFloat>
+		inline explicit int128(TFloat value) noexcept;
+
+		constexpr explicit operator bool() const noexcept;
+
+		//to the builtin integers: truncates
+		template<typename Integer>
+			requires (std::is_integral_v<Integer> && !std::is_same_v<Integer, bool> && concepts::builtin_integer<Integer>)
+		constexpr explicit operator Integer() const noexcept;
+
+		//the two's complement bits
+		constexpr explicit operator uint128() const noexcept;
+
+		template<concepts::builtin_floating_point TFloat>
+		inline explicit operator TFloat() const;
+
+		[[nodiscard]] constexpr std::uint64_t low_part() const noexcept;
+		[[nodiscard]] constexpr std::int64_t high_part() const noexcept;
+		[[nodiscard]] constexpr bool is_negative() const noexcept;
+		[[nodiscard]] constexpr byte_array to_little_endian_arr() const noexcept;
+		[[nodiscard]] constexpr byte_array to_big_endian_arr() const noexcept;
+		[[nodiscard]] constexpr size_t hash_code() const noexcept;
+
+		constexpr int128& operator+=(int128 other) noexcept;
+		constexpr int128& operator-=(int128 other) noexcept;
+		constexpr int128& operator*=(int128 other) noexcept;
+		constexpr int128& operator/=(int128 other);
+		constexpr int128& operator%=(int128 other);
+		constexpr int128& operator&=(int128 other) noexcept;
+		constexpr int128& operator|=(int128 other) noexcept;
+		constexpr int128& operator^=(int128 other) noexcept;
+		constexpr int128& operator<<=(int amount) noexcept;
+		//arithmetic: the sign bit is shifted in
+		constexpr int128& operator>>=(int amount) noexcept;
+		constexpr int128& operator++() noexcept;
+		constexpr int128& operator--() noexcept;
+		constexpr int128 operator++(int) noexcept;
+		constexpr int128 operator--(int) noexcept;
+
+		//Hidden friends, so that either operand may be anything implicitly convertible to int128.
+		friend constexpr int128 operator+(int128 lhs, int128 rhs) noexcept { return lhs += rhs; }
+		friend constexpr int128 operator-(int128 lhs, int128 rhs) noexcept { return lhs -= rhs; }
+		friend constexpr int128 operator*(int128 lhs, int128 rhs) noexcept { return lhs *= rhs; }
+		friend constexpr int128 operator/(int128 lhs, int128 rhs) { return lhs /= rhs; }
+		friend constexpr int128 operator%(int128 lhs, int128 rhs) { return lhs %= rhs; }
+		friend constexpr int128 operator&(int128 lhs, int128 rhs) noexcept { return lhs &= rhs; }
+		friend constexpr int128 operator|(int128 lhs, int128 rhs) noexcept { return lhs |= rhs; }
+		friend constexpr int128 operator^(int128 lhs, int128 rhs) noexcept { return lhs ^= rhs; }
+		friend constexpr int128 operator<<(int128 lhs, int amount) noexcept { return lhs <<= amount; }
+		friend constexpr int128 operator>>(int128 lhs, int amount) noexcept { return lhs >>= amount; }
+		friend constexpr int128 operator+(int128 operand) noexcept { return operand; }
+		friend constexpr int128 operator-(int128 operand) noexcept { return int128{ -operand.m_value }; }
+		friend constexpr int128 operator~(int128 operand) noexcept { return int128{ ~operand.m_value }; }
+		friend constexpr bool operator!(int128 operand) noexcept { return !operand.m_value; }
+		friend constexpr bool operator==(int128 lhs, int128 rhs) noexcept { return lhs.m_value == rhs.m_value; }
+		friend constexpr std::strong_ordering operator<=>(int128 lhs, int128 rhs) noexcept;
+
+	private:
+		static constexpr std::errc parse(std::string_view text, int128& value) noexcept;
+		//runtime only: the native type where calculation_mode is intrinsic_u128
+		static natint128_t to_native(int128 value) noexcept;
+		static int128 from_native(natint128_t value) noexcept;
+
+		uint128 m_value;
+	};
+
+	/// <summary>
+	/// lhs + rhs.
+	/// </summary>
+	/// <returns>std::nullopt if the sum does not fit in an int128.</returns>
+	constexpr std::optional<int128> checked_add(int128 lhs, int128 rhs) noexcept;
+
+	/// <summary>
+	/// lhs - rhs.
+	/// </summary>
+	/// <returns>std::nullopt if the difference does not fit in an int128.</returns>
+	constexpr std::optional<int128> checked_sub(int128 lhs, int128 rhs) noexcept;
+
+	/// <summary>
+	/// lhs * rhs.
+	/// </summary>
+	/// <returns>std::nullopt if the product does not fit in an int128.</returns>
+	constexpr std::optional<int128> checked_mul(int128 lhs, int128 rhs) noexcept;
+
+	/// <summary>
+	/// dividend / divisor, truncated toward zero.
+	/// </summary>
+	/// <returns>std::nullopt if divisor is zero or the quotient (min() / -1) does not fit.</returns>
+	constexpr std::optional<int128> checked_div(int128 dividend, int128 divisor) noexcept;
+
+	/// <summary>
+	/// lhs + rhs, clamped to [min(), max()].
+	/// </summary>
+	constexpr int128 saturating_add(int128 lhs, int128 rhs) noexcept;
+
+	/// <summary>
+	/// lhs - rhs, clamped to [min(), max()].
+	/// </summary>
+	constexpr int128 saturating_sub(int128 lhs, int128 rhs) noexcept;
+
+	/// <summary>
+	/// lhs * rhs, clamped to [min(), max()].
+	/// </summary>
+	constexpr int128 saturating_mul(int128 lhs, int128 rhs) noexcept;
+
+	/// <summary>
+	/// dividend / divisor, truncated toward zero; min() / -1 is max().
+	/// </summary>
+	/// <exception cref="std::domain_error">divisor is zero.</exception>
+	constexpr int128 saturating_div(int128 dividend, int128 divisor);
+
+	namespace math_functions
+	{
+		/// <summary>
+		/// The magnitude of val (abs(min()) does not fit in an int128 but does in a uint128).
+		/// </summary>
+		constexpr uint128 int_abs(int128 val) noexcept;
+
+		constexpr int128 int_sign(int128 val) noexcept;
+	}
+
+	/// <summary>
+	/// Writes value in base [2, 36] to [first, last) with the semantics of std::to_chars for the builtin
+	/// signed integers: a '-' for negative values followed by the magnitude, with no prefix or padding.
+	/// </summary>
+	constexpr std::to_chars_result to_chars(char* first, char* last, int128 value, int base = 10) noexcept;
+
+	/// <summary>
+	/// Parses an int128 from [first, last) with the semantics of std::from_chars for the builtin
+	/// signed integers: an optional '-' then digits; no '+', prefix or whitespace is accepted.
+	/// </summary>
+	constexpr std::from_chars_result from_chars(const char* first, const char* last, int128& value, int base = 10) noexcept;
+
+	/// <summary>
+	/// Behaves as stream insertion of a builtin signed integer: decimal output is signed (honoring
+	/// showpos) while hex and oct output show the two's complement bits.  Width, fill and
+	/// adjustfield (including internal) are honored.
+	/// </summary>
+	template<typename Char, typename CharTraits>
+		requires cjm::numerics::concepts::char_with_traits<Char, CharTraits>
+	std::basic_ostream<Char, CharTraits>& operator<<(std::basic_ostream<Char, CharTraits>& os, int128 value);
+
+	/// <summary>
+	/// Extracts a whitespace-delimited token in any form accepted by int128::make_from_string;
+	/// sets failbit (and leaves value zero) if it cannot be parsed.
+	/// </summary>
+	template<typename Char, typename CharTraits>
+		requires cjm::numerics::concepts::char_or_wchar_t_with_traits<Char, CharTraits>
+	std::basic_istream<Char, CharTraits>& operator>>(std::basic_istream<Char, CharTraits>& is, int128& value);
+
+	namespace int128_literals
+	{
+		/************************************************************************/
+		/* Accepts decimal, hexadecimal and binary literals (with ' separators),
+		 * just like _u128, whose value is at most max().  Out of range or
+		 * illegal literals fail to compile.									*/
+		/************************************************************************/
+		template<char... Chars>
+			requires (sizeof...(Chars) > 0)
+		constexpr int128 operator"" _i128();
+	}
+}
+#include <cjm/numerics/int128.inl>
+#endif
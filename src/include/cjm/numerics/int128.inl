@@ -0,0 +1,716 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_INT128_INL_
+#define CJM_INT128_INL_
+#include <cjm/numerics/int128.hpp>
+
+namespace cjm::numerics
+{
+	constexpr int128 int128::make_from_string(std::string_view text)
+	{
+		int128 ret{};
+		const std::errc error = parse(text, ret);
+		if (error == std::errc::result_out_of_range)
+		{
+			throw std::overflow_error{ "The value does not fit in an int128." };
+		}
+		if (error != std::errc{})
+		{
+			throw std::invalid_argument{ "The text is not a signed decimal or 0x-prefixed hexadecimal number." };
+		}
+		return ret;
+	}
+
+	constexpr std::optional<int128> int128::try_make_from_string(std::string_view text) noexcept
+	{
+		int128 ret{};
+		if (parse(text, ret) != std::errc{})
+		{
+			return std::nullopt;
+		}
+		return ret;
+	}
+
+	constexpr std::errc int128::parse(std::string_view text, int128& value) noexcept
+	{
+		constexpr std::string_view whitespace = " \t\n\v\f\r";
+		const auto first_non_space = text.find_first_not_of(whitespace);
+		if (first_non_space == std::string_view::npos)
+		{
+			return std::errc::invalid_argument;
+		}
+		text = text.substr(first_non_space, text.find_last_not_of(whitespace) - first_non_space + 1);
+		const bool negative = text[0] == '-';
+		if (negative || text[0] == '+')
+		{
+			text.remove_prefix(1);
+		}
+		int base = 10;
+		if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+		{
+			base = 16;
+			text.remove_prefix(2);
+		}
+		const char* const last = text.data() + text.size();
+		uint128 magnitude{};
+		const auto [ptr, ec] = from_chars(text.data(), last, magnitude, base);
+		if (ec != std::errc{})
+		{
+			return ec;
+		}
+		if (ptr != last)
+		{
+			return std::errc::invalid_argument;
+		}
+		if (magnitude > static_cast<uint128>(std::numeric_limits<int128>::max()) + (negative ? 1 : 0))
+		{
+			return std::errc::result_out_of_range;
+		}
+		value = negative ? -int128{ magnitude } : int128{ magnitude };
+		return std::errc{};
+	}
+
+	inline natint128_t int128::to_native(int128 value) noexcept
+	{
+		return static_cast<natint128_t>(static_cast<natuint128_t>(value.m_value));
+	}
+
+	inline int128 int128::from_native(natint128_t value) noexcept
+	{
+		return int128{ static_cast<uint128>(static_cast<natuint128_t>(value)) };
+	}
+
+	constexpr int128 int128::make_from_bytes_little_endian(byte_array bytes) noexcept
+	{
+		return int128{ uint128::make_from_bytes_little_endian(bytes) };
+	}
+
+	constexpr int128 int128::make_from_bytes_big_endian(byte_array bytes) noexcept
+	{
+		return int128{ uint128::make_from_bytes_big_endian(bytes) };
+	}
+
+	constexpr int128 int128::make_int128(std::int64_t high, std::uint64_t low) noexcept
+	{
+		return int128{ high, low };
+	}
+
+	constexpr std::optional<int128::divmod_result_t> int128::try_div_mod(int128 dividend, int128 divisor) noexcept
+	{
+		if (divisor == 0)
+		{
+			return std::nullopt;
+		}
+		return unsafe_div_mod(dividend, divisor);
+	}
+
+	constexpr int128::divmod_result_t int128::div_mod(int128 dividend, int128 divisor)
+	{
+		if (divisor == 0)
+		{
+			throw std::domain_error("Division and/or modulus by zero is forbidden.");
+		}
+		return unsafe_div_mod(dividend, divisor);
+	}
+
+	constexpr int128::divmod_result_t int128::unsafe_div_mod(int128 dividend, int128 divisor) noexcept
+	{
+		assert(divisor != 0);
+		if (!std::is_constant_evaluated())
+		{
+			if constexpr (calculation_mode == uint128_calc_mode::intrinsic_u128)
+			{
+				//min() / -1 overflows the native type (and traps on x64); here it wraps
+				if (divisor == -1)
+				{
+					return divmod_result_t{ -dividend, 0 };
+				}
+				const natint128_t native_dividend = to_native(dividend);
+				const natint128_t native_divisor = to_native(divisor);
+				return divmod_result_t{ from_native(native_dividend / native_divisor),
+					from_native(native_dividend % native_divisor) };
+			}
+		}
+		//divide the magnitudes (with uint128's division) then negate without branching:
+		//(x ^ mask) - mask is -x when mask is all ones and x when it is zero
+		const auto [quotient, remainder] = uint128::unsafe_div_mod(math_functions::int_abs(dividend),
+			math_functions::int_abs(divisor));
+		const uint128 remainder_mask = static_cast<uint128>(dividend >> 127);
+		const uint128 quotient_mask = remainder_mask ^ static_cast<uint128>(divisor >> 127);
+		return divmod_result_t{ int128{ (quotient ^ quotient_mask) - quotient_mask },
+			int128{ (remainder ^ remainder_mask) - remainder_mask } };
+	}
+
+	constexpr int128::int128(std::int64_t high, std::uint64_t low) noexcept
+		: m_value{ static_cast<std::uint64_t>(high), low } {}
+
+	template<concepts::builtin_integer Integer>
+	constexpr int128::int128(Integer value) noexcept : m_value{}
+	{
+		if constexpr (sizeof(Integer) > sizeof(std::uint64_t))
+		{
+			using unsigned_t = std::make_unsigned_t<Integer>;
+			const auto bits = static_cast<unsigned_t>(value);
+			m_value = uint128::make_uint128(static_cast<std::uint64_t>(bits >> std::numeric_limits<std::uint64_t>::digits),
+				static_cast<std::uint64_t>(bits));
+		}
+		else if constexpr (std::is_signed_v<Integer>)
+		{
+			m_value = uint128::make_uint128(value < 0 ? ~std::uint64_t{} : 0,
+				static_cast<std::uint64_t>(static_cast<std::int64_t>(value)));
+		}
+		else
+		{
+			m_value = uint128::make_uint128(0, static_cast<std::uint64_t>(value));
+		}
+	}
+
+	template<concepts::builtin_floating_point TFloat>
+	int128::int128(TFloat value) noexcept : m_value{}
+	{
+		assert(std::abs(value) < std::ldexp(static_cast<TFloat>(1), std::numeric_limits<int128>::digits));
+		m_value = value < 0 ? -uint128{ -value } : uint128{ value };
+	}
+
+	constexpr int128::operator bool() const noexcept
+	{
+		return static_cast<bool>(m_value);
+	}
+
+	template<typename Integer>
+		requires (std::is_integral_v<Integer> && !std::is_same_v<Integer, bool> && concepts::builtin_integer<Integer>)
+	constexpr int128::operator Integer() const noexcept
+	{
+		if constexpr (sizeof(Integer) > sizeof(std::uint64_t))
+		{
+			using unsigned_t = std::make_unsigned_t<Integer>;
+			return static_cast<Integer>((static_cast<unsigned_t>(m_value.high_part()) << std::numeric_limits<std::uint64_t>::digits)
+				| static_cast<unsigned_t>(m_value.low_part()));
+		}
+		else
+		{
+			return static_cast<Integer>(m_value.low_part());
+		}
+	}
+
+	constexpr int128::operator uint128() const noexcept
+	{
+		return m_value;
+	}
+
+	template<concepts::builtin_floating_point TFloat>
+	int128::operator TFloat() const
+	{
+		const auto magnitude = static_cast<TFloat>(math_functions::int_abs(*this));
+		return is_negative() ? -magnitude : magnitude;
+	}
+
+	constexpr std::uint64_t int128::low_part() const noexcept
+	{
+		return m_value.low_part();
+	}
+
+	constexpr std::int64_t int128::high_part() const noexcept
+	{
+		return static_cast<std::int64_t>(m_value.high_part());
+	}
+
+	constexpr bool int128::is_negative() const noexcept
+	{
+		return high_part() < 0;
+	}
+
+	constexpr int128::byte_array int128::to_little_endian_arr() const noexcept
+	{
+		return m_value.to_little_endian_arr();
+	}
+
+	constexpr int128::byte_array int128::to_big_endian_arr() const noexcept
+	{
+		return m_value.to_big_endian_arr();
+	}
+
+	constexpr size_t int128::hash_code() const noexcept
+	{
+		return m_value.hash_code();
+	}
+
+	constexpr int128& int128::operator+=(int128 other) noexcept
+	{
+		m_value += other.m_value;
+		return *this;
+	}
+
+	constexpr int128& int128::operator-=(int128 other) noexcept
+	{
+		m_value -= other.m_value;
+		return *this;
+	}
+
+	constexpr int128& int128::operator*=(int128 other) noexcept
+	{
+		//the low 128 bits of a two's complement product do not depend on the signs
+		m_value *= other.m_value;
+		return *this;
+	}
+
+	constexpr int128& int128::operator/=(int128 other)
+	{
+		*this = div_mod(*this, other).quotient;
+		return *this;
+	}
+
+	constexpr int128& int128::operator%=(int128 other)
+	{
+		*this = div_mod(*this, other).remainder;
+		return *this;
+	}
+
+	constexpr int128& int128::operator&=(int128 other) noexcept
+	{
+		m_value &= other.m_value;
+		return *this;
+	}
+
+	constexpr int128& int128::operator|=(int128 other) noexcept
+	{
+		m_value |= other.m_value;
+		return *this;
+	}
+
+	constexpr int128& int128::operator^=(int128 other) noexcept
+	{
+		m_value ^= other.m_value;
+		return *this;
+	}
+
+	constexpr int128& int128::operator<<=(int amount) noexcept
+	{
+		m_value <<= amount;
+		return *this;
+	}
+
+	constexpr int128& int128::operator>>=(int amount) noexcept
+	{
+		//It is undefined behavior to attempt a shift greater than number of bits in an integral type
+		assert(amount > -1 && amount < std::numeric_limits<uint128>::digits);
+		constexpr int half_bits = std::numeric_limits<std::uint64_t>::digits;
+		const std::int64_t high = high_part();
+		if (!std::is_constant_evaluated())
+		{
+			if constexpr (calculation_mode == uint128_calc_mode::intrinsic_u128)
+			{
+				*this = from_native(to_native(*this) >> amount);
+				return *this;
+			}
+			else if constexpr (calculation_mode == uint128_calc_mode::msvc_x64
+				|| calculation_mode == uint128_calc_mode::msvc_x64_clang_or_intel_llvm)
+			{
+				if (amount < half_bits)
+				{
+					*this = make_int128(high >> amount, CJM_RSHIFT128(low_part(), static_cast<std::uint64_t>(high),
+						static_cast<unsigned char>(amount)));
+					return *this;
+				}
+			}
+		}
+		//signed right shifts of the builtin types are arithmetic as of C++20
+		if (amount >= half_bits)
+		{
+			*this = make_int128(high >> (half_bits - 1), static_cast<std::uint64_t>(high >> (amount - half_bits)));
+		}
+		else if (amount != 0)
+		{
+			*this = make_int128(high >> amount,
+				(low_part() >> amount) | (static_cast<std::uint64_t>(high) << (half_bits - amount)));
+		}
+		return *this;
+	}
+
+	constexpr int128& int128::operator++() noexcept
+	{
+		++m_value;
+		return *this;
+	}
+
+	constexpr int128& int128::operator--() noexcept
+	{
+		--m_value;
+		return *this;
+	}
+
+	constexpr int128 int128::operator++(int) noexcept
+	{
+		const int128 ret = *this;
+		++m_value;
+		return ret;
+	}
+
+	constexpr int128 int128::operator--(int) noexcept
+	{
+		const int128 ret = *this;
+		--m_value;
+		return ret;
+	}
+
+	constexpr std::strong_ordering operator<=>(int128 lhs, int128 rhs) noexcept
+	{
+		if (!std::is_constant_evaluated())
+		{
+			if constexpr (calculation_mode == uint128_calc_mode::intrinsic_u128)
+			{
+				return int128::to_native(lhs) <=> int128::to_native(rhs);
+			}
+		}
+		//the high halves carry the sign; the low halves are unsigned magnitudes below them
+		if (lhs.high_part() != rhs.high_part())
+		{
+			return lhs.high_part() <=> rhs.high_part();
+		}
+		return lhs.low_part() <=> rhs.low_part();
+	}
+
+	constexpr std::optional<int128> checked_add(int128 lhs, int128 rhs) noexcept
+	{
+		const int128 sum = lhs + rhs;
+		//overflow iff both addends have the same sign and the sum has the other one
+		if (((lhs ^ sum) & (rhs ^ sum)).is_negative())
+		{
+			return std::nullopt;
+		}
+		return sum;
+	}
+
+	constexpr std::optional<int128> checked_sub(int128 lhs, int128 rhs) noexcept
+	{
+		const int128 difference = lhs - rhs;
+		//overflow iff the operands' signs differ and the difference's sign differs from the minuend's
+		if (((lhs ^ rhs) & (lhs ^ difference)).is_negative())
+		{
+			return std::nullopt;
+		}
+		return difference;
+	}
+
+	constexpr std::optional<int128> checked_mul(int128 lhs, int128 rhs) noexcept
+	{
+		const bool negative = lhs.is_negative() != rhs.is_negative();
+		const u128_wide_product product = wide_multiply(math_functions::int_abs(lhs), math_functions::int_abs(rhs));
+		//a negative product may have a magnitude one greater than max()
+		if (product.high != 0 ||
+			product.low > static_cast<uint128>(std::numeric_limits<int128>::max()) + (negative ? 1 : 0))
+		{
+			return std::nullopt;
+		}
+		return negative ? -int128{ product.low } : int128{ product.low };
+	}
+
+	constexpr std::optional<int128> checked_div(int128 dividend, int128 divisor) noexcept
+	{
+		if (divisor == 0 || (divisor == -1 && dividend == std::numeric_limits<int128>::min()))
+		{
+			return std::nullopt;
+		}
+		return int128::unsafe_div_mod(dividend, divisor).quotient;
+	}
+
+	constexpr int128 saturating_add(int128 lhs, int128 rhs) noexcept
+	{
+		const std::optional<int128> sum = checked_add(lhs, rhs);
+		if (!sum.has_value())
+		{
+			return lhs.is_negative() ? std::numeric_limits<int128>::min() : std::numeric_limits<int128>::max();
+		}
+		return *sum;
+	}
+
+	constexpr int128 saturating_sub(int128 lhs, int128 rhs) noexcept
+	{
+		const std::optional<int128> difference = checked_sub(lhs, rhs);
+		if (!difference.has_value())
+		{
+			return lhs.is_negative() ? std::numeric_limits<int128>::min() : std::numeric_limits<int128>::max();
+		}
+		return *difference;
+	}
+
+	constexpr int128 saturating_mul(int128 lhs, int128 rhs) noexcept
+	{
+		const std::optional<int128> product = checked_mul(lhs, rhs);
+		if (!product.has_value())
+		{
+			return lhs.is_negative() != rhs.is_negative() ? std::numeric_limits<int128>::min()
+				: std::numeric_limits<int128>::max();
+		}
+		return *product;
+	}
+
+	constexpr int128 saturating_div(int128 dividend, int128 divisor)
+	{
+		if (divisor == -1 && dividend == std::numeric_limits<int128>::min())
+		{
+			return std::numeric_limits<int128>::max();
+		}
+		return int128::div_mod(dividend, divisor).quotient;
+	}
+
+	namespace math_functions
+	{
+		constexpr uint128 int_abs(int128 val) noexcept
+		{
+			//all ones for a negative value, zero otherwise
+			const auto mask = static_cast<uint128>(val >> 127);
+			return (static_cast<uint128>(val) ^ mask) - mask;
+		}
+
+		constexpr int128 int_sign(int128 val) noexcept
+		{
+			return val.is_negative() ? int128{ -1 } : int128{ 1 };
+		}
+	}
+
+	constexpr std::to_chars_result to_chars(char* first, char* last, int128 value, int base) noexcept
+	{
+		if (value.is_negative())
+		{
+			if (first == last)
+			{
+				return std::to_chars_result{ last, std::errc::value_too_large };
+			}
+			*first++ = '-';
+		}
+		return to_chars(first, last, math_functions::int_abs(value), base);
+	}
+
+	constexpr std::from_chars_result from_chars(const char* first, const char* last, int128& value, int base) noexcept
+	{
+		const bool negative = first != last && *first == '-';
+		uint128 magnitude{};
+		const auto result = from_chars(first + (negative ? 1 : 0), last, magnitude, base);
+		if (result.ec == std::errc::invalid_argument)
+		{
+			return std::from_chars_result{ first, std::errc::invalid_argument };
+		}
+		if (result.ec != std::errc{})
+		{
+			return result;
+		}
+		if (magnitude > static_cast<uint128>(std::numeric_limits<int128>::max()) + (negative ? 1 : 0))
+		{
+			return std::from_chars_result{ result.ptr, std::errc::result_out_of_range };
+		}
+		value = negative ? -int128{ magnitude } : int128{ magnitude };
+		return result;
+	}
+
+	template<typename Char, typename CharTraits>
+		requires cjm::numerics::concepts::char_with_traits<Char, CharTraits>
+	std::basic_ostream<Char, CharTraits>& operator<<(std::basic_ostream<Char, CharTraits>& os, int128 value)
+	{
+		using ios = std::basic_ios<Char, CharTraits>;
+		using iosflags = typename ios::fmtflags;
+		const iosflags flags = os.flags();
+		if ((flags & ios::basefield) == ios::hex || (flags & ios::basefield) == ios::oct)
+		{
+			//like the builtin signed integers: the bits, not the sign and magnitude
+			return os << static_cast<uint128>(value);
+		}
+		typename std::basic_ostream<Char, CharTraits>::sentry sentry{ os };
+		if (!sentry)
+			return os;
+		//a sign and the digits of the largest magnitude
+		constexpr size_t max_chars = std::numeric_limits<uint128>::digits10 + 2;
+		std::array<char, max_chars> narrow{};
+		char* begin = narrow.data();
+		if (value.is_negative())
+		{
+			*begin++ = '-';
+		}
+		else if (flags & ios::showpos)
+		{
+			*begin++ = '+';
+		}
+		const auto sign_size = static_cast<std::streamsize>(begin - narrow.data());
+		char* const end = to_chars(begin, narrow.data() + narrow.size(), math_functions::int_abs(value)).ptr;
+		std::array<Char, max_chars> rep{};
+		std::transform(narrow.data(), end, rep.begin(), [](char c) -> Char { return static_cast<Char>(c); });
+		const auto rep_size = static_cast<std::streamsize>(end - narrow.data());
+
+		std::streamsize width = os.width(0);
+		std::streamsize fill_before = 0;
+		std::streamsize prefix_size = 0;
+		std::streamsize fill_after_prefix = 0;
+		std::streamsize fill_after = 0;
+		if (width > rep_size)
+		{
+			const std::streamsize width_less_size = width - rep_size;
+			const iosflags adjustfield = flags & ios::adjustfield;
+			if (adjustfield == ios::left)
+			{
+				fill_after = width_less_size;
+			}
+			else if (adjustfield == ios::internal)
+			{
+				prefix_size = sign_size;
+				fill_after_prefix = width_less_size;
+			}
+			else
+			{
+				fill_before = width_less_size;
+			}
+		}
+
+		auto* const buffer = os.rdbuf();
+		//only consult fill when padding: it requires a ctype facet the utf streams may lack
+		auto put_fill = [buffer, &os](std::streamsize count) -> bool
+		{
+			const Char fill = count > 0 ? os.fill() : Char{};
+			for (; count > 0; --count)
+			{
+				if (CharTraits::eq_int_type(buffer->sputc(fill), CharTraits::eof()))
+					return false;
+			}
+			return true;
+		};
+		const bool written = put_fill(fill_before)
+			&& buffer->sputn(rep.data(), prefix_size) == prefix_size
+			&& put_fill(fill_after_prefix)
+			&& buffer->sputn(rep.data() + prefix_size, rep_size - prefix_size) == rep_size - prefix_size
+			&& put_fill(fill_after);
+		if (!written)
+		{
+			os.setstate(std::ios_base::badbit);
+		}
+		return os;
+	}
+
+	template<typename Char, typename CharTraits>
+		requires cjm::numerics::concepts::char_or_wchar_t_with_traits<Char, CharTraits>
+	std::basic_istream<Char, CharTraits>& operator>>(std::basic_istream<Char, CharTraits>& is, int128& value)
+	{
+		value = 0;
+		std::basic_string<Char, CharTraits> token;
+		if (!(is >> token))
+		{
+			return is;
+		}
+		//anything outside ascii cannot be part of a number
+		std::string narrow;
+		narrow.reserve(token.size());
+		for (const Char c : token)
+		{
+			const auto code = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<Char>>(c));
+			narrow.push_back(code < 0x80u ? static_cast<char>(code) : '\0');
+		}
+		if (const auto parsed = int128::try_make_from_string(narrow); parsed.has_value())
+		{
+			value = *parsed;
+		}
+		else
+		{
+			is.setstate(std::ios_base::failbit);
+		}
+		return is;
+	}
+
+	namespace int128_literals
+	{
+		template<char... Chars>
+			requires (sizeof...(Chars) > 0)
+		constexpr int128 operator"" _i128()
+		{
+			constexpr std::optional<uint128> result = uint128_literals::lit_helper::parse_literal<uint128,
+				Chars...>();
+			static_assert(result.has_value() && *result <= static_cast<uint128>(std::numeric_limits<int128>::max()),
+				"This literal is not a valid decimal, hexadecimal or binary int128.");
+			return int128{ *result };
+		}
+	}
+}
+
+constexpr size_t std::hash<cjm::numerics::int128>::operator()(const cjm::numerics::int128& key_val) const noexcept
+{
+	return key_val.hash_code();
+}
+
+#ifdef __cpp_lib_format
+template<typename Char>
+constexpr typename std::basic_format_parse_context<Char>::iterator
+	std::formatter<cjm::numerics::int128, Char>::parse(std::basic_format_parse_context<Char>& ctx)
+{
+	return cjm::numerics::internal::parse_u128_format_context(ctx, m_spec);
+}
+
+template<typename Char>
+template<typename FormatContext>
+typename FormatContext::iterator std::formatter<cjm::numerics::int128, Char>::format(cjm::numerics::int128 value,
+	FormatContext& ctx) const
+{
+	const size_t width = cjm::numerics::internal::resolve_u128_format_width(m_spec, ctx);
+	return cjm::numerics::internal::write_u128_formatted(ctx.out(), cjm::numerics::math_functions::int_abs(value),
+		m_spec, width, value.is_negative());
+}
+#endif
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::min() noexcept
+{
+	return cjm::numerics::int128::make_int128(std::numeric_limits<std::int64_t>::min(), 0);
+}
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::lowest() noexcept
+{
+	return min();
+}
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::max() noexcept
+{
+	return cjm::numerics::int128::make_int128(std::numeric_limits<std::int64_t>::max(),
+		std::numeric_limits<std::uint64_t>::max());
+}
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::epsilon() noexcept
+{
+	return 0;
+}
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::round_error() noexcept
+{
+	return 0;
+}
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::infinity() noexcept
+{
+	return 0;
+}
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::quiet_NaN() noexcept
+{
+	return 0;
+}
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::signaling_NaN() noexcept
+{
+	return 0;
+}
+
+constexpr cjm::numerics::int128 std::numeric_limits<cjm::numerics::int128>::denorm_min() noexcept
+{
+	return 0;
+}
+#endif
@@ -42,7 +42,7 @@
 #error "CJM NUMERICS UINT128 requires support for C++20 three way comparison operator <=>."
 #endif
 #ifndef __cpp_nontype_template_args
-#error	"CJM NUMERICS UINT128 plans to require support for C++20 class non-type template arguments."
+#error	"CJM NUMERICS UINT128 requires support for C++20 class non-type template arguments."
 #endif
 #ifndef __cpp_lib_bitops
 #error	"CJM NUMERICS UINT128 requires standard library support for C++20 bit operations."
@@ -85,11 +85,15 @@
 #include <immintrin.h>
 #pragma intrinsic(_umul128)
 #pragma intrinsic(_BitScanReverse64)
+#pragma intrinsic(_BitScanForward64)
+#pragma intrinsic(_byteswap_uint64)
 #pragma intrinsic(__lzcnt64)
 #pragma intrinsic(__shiftleft128)
 #pragma intrinsic(__shiftright128)
 #pragma intrinsic(_subborrow_u64)
 #define CJM_BITSCAN_REV_64 _BitScanReverse64
+#define CJM_BITSCAN_FWD_64 _BitScanForward64
+#define CJM_BYTESWAP_64 _byteswap_uint64
 #define CJM_LZCNT_64 __lzcnt64
 #define CJM_LSHIFT128 __shiftleft128
 #define CJM_RSHIFT128 __shiftright128
@@ -117,6 +121,8 @@
 #else
 #define CJM_UMUL128 cjm::numerics::internal::cjm_bad_umul128
 #define CJM_BITSCAN_REV_64 cjm::numerics::internal::cjm_badrev_bitscan_64
+#define CJM_BITSCAN_FWD_64 cjm::numerics::internal::cjm_badfwd_bitscan_64
+#define CJM_BYTESWAP_64 cjm::numerics::internal::cjm_bad_byteswap_64
 #define CJM_LZCNT_64 cjm::numerics::internal::cjm_bad_lzcnt_64
 #define CJM_LSHIFT128 cjm::numerics::internal::cjm_bad_shiftleft128
 #define CJM_RSHIFT128 cjm::numerics::internal::cjm_bad_shiftright128
@@ -125,6 +131,10 @@
 #define CJM_UDIV128 cjm::numerics::internal::cjm_bad_udiv128
 #endif
 
+#if defined(CJM_DETECTED_SSSE3) && !defined(CJM_BASE_INTRINSICS_AVAILABLE)
+#include <immintrin.h>
+#endif
+
 #ifdef __cpp_lib_bit_cast
 #define CJM_BIT_CAST_CONST constexpr
 #else
@@ -196,6 +206,8 @@ namespace cjm
 			//alternate declarations for cjm_intrinsic_macros ... never defined because never used but need something that won't blow compiler up
 			//when examining untaken if constexpr branch.
 			extern unsigned char cjm_badrev_bitscan_64(unsigned long* index, std::uint64_t mask);
+			extern unsigned char cjm_badfwd_bitscan_64(unsigned long* index, std::uint64_t mask);
+			extern std::uint64_t cjm_bad_byteswap_64(std::uint64_t value);
 			extern std::uint64_t cjm_bad_lzcnt_64(std::uint64_t mask);
 			extern std::uint64_t cjm_bad_umul128(std::uint64_t multiplicand, std::uint64_t multiplicand_two, std::uint64_t* carry);
 			extern std::uint64_t cjm_bad_udiv128(std::uint64_t high_dividend, std::uint64_t low_dividend, std::uint64_t divisor, std::uint64_t* remainder);
@@ -225,6 +237,7 @@ namespace cjm
 		constexpr compiler_used value_or_other_ifndef(compiler_used v) noexcept;
 		
 		class uint128;
+		class int128;
 		constexpr bool is_windows =
 #if defined (CJM_DETECTED_WINDOWS)
 			true;
@@ -279,6 +292,7 @@ namespace cjm
 			true;
 		using uint128_align_t = unsigned __int128;
 		using natuint128_t = unsigned __int128;
+		using natint128_t = __int128;
 		using divonlynatuint128_t = unsigned __int128;
 #elif defined(CJM_DIV_ONLY_INTRINSIC_U128)
 			false;
@@ -293,6 +307,7 @@ namespace cjm
 
 		using uint128_align_t = internal::cjm_align;
 		using natuint128_t = uint128;
+		using natint128_t = int128;
 		using divonlynatuint128_t = unsigned __int128;
 #else
 			false;
@@ -306,6 +321,7 @@ namespace cjm
 		}
 		using uint128_align_t = std::conditional_t<is_x64, internal::cjm_align, std::uint64_t>;
 		using natuint128_t = uint128;
+		using natint128_t = int128;
 		using divonlynatuint128_t = uint128;
 #endif
 
@@ -315,6 +331,18 @@ namespace cjm
 			true;
 #else
 			false;
+#endif
+		constexpr bool ssse3_available =
+#if defined(CJM_DETECTED_SSSE3)
+			true;
+#else
+			false;
+#endif
+		constexpr bool avx2_available =
+#if defined(CJM_DETECTED_AVX2)
+			true;
+#else
+			false;
 #endif
 		constexpr bool intel_adx_available =
 #if defined(CJM_NUMERICS_UINT128_INTEL_ADX)
@@ -51,6 +51,7 @@
 #include <utility>
 #include <algorithm>
 #include <cjm/numerics/numerics.hpp>
+#include <cjm/numerics/cpu_features.hpp>
 #include <cjm/numerics/cjm_numeric_concepts.hpp>
 #include <cjm/string/cjm_string.hpp>
 #include <cmath>
@@ -58,6 +59,16 @@
 #include <cctype>
 #include <cwctype>
 #include <concepts>
+#include <charconv>
+#include <system_error>
+#include <cstring>
+#include <span>
+#include <thread>
+#include <vector>
+#include <version>
+#if __has_include(<format>)
+#include <format>
+#endif
 // Copyright 2018 CJM Screws, LLC
 // 
 // This contents of this file (uint128.hpp) and its inline implementation file (uint128.inl)
@@ -114,13 +125,15 @@ namespace cjm::numerics
 {
 	class uint128;
 
+	struct u128_parse_result;
+
 	///<summary>
-	///In the future, will define
-	///cjm unsigned integers of larger type implemented in terms
-	///of a cjm unsigned integer of smaller type.
+	///A cjm unsigned integer twice as wide as LimbType, implemented in terms
+	///of a pair of LimbTypes (e.g. uint256 is a pair of uint128s).
+	///Defined in <cjm/numerics/fixed_uint.hpp>.
 	///</summary>
 	template<concepts::cjm_unsigned_integer LimbType>
-	class [[maybe_unused]] fixed_uint;
+	class fixed_uint;
 
 	template<concepts::integer IntegerType>
 	struct divmod_result;
@@ -146,7 +159,16 @@ namespace cjm::numerics
 		template<cjm::numerics::concepts::builtin_unsigned_integer UI>
 		constexpr int countl_zero(UI n) noexcept;
 
-		constexpr int countl_zero(uint128 n) noexcept;
+		/// <summary>
+		/// 64-bit building blocks of the uint128 &lt;bit&gt; functions: __builtin_clzll, __builtin_ctzll,
+		/// __builtin_popcountll and __builtin_bswap64 with GCC and Clang, _BitScanReverse64,
+		/// _BitScanForward64 and _byteswap_uint64 on Microsoft x64, the std:: functions elsewhere
+		/// and when constant evaluated.  Like their std:: counterparts, the counts are 64 for zero.
+		/// </summary>
+		constexpr int countl_zero_u64(std::uint64_t n) noexcept;
+		constexpr int countr_zero_u64(std::uint64_t n) noexcept;
+		constexpr int popcount_u64(std::uint64_t n) noexcept;
+		constexpr std::uint64_t byteswap_u64(std::uint64_t n) noexcept;
 		
 		template <typename T>
 		constexpr void step(T& n, int& pos, int shift) noexcept;
@@ -173,6 +195,218 @@ namespace cjm::numerics
 			requires (sizeof(Ui128) == 16 && !concepts::builtin_128bit_unsigned_integer<Ui128>)
 		Ui128 add_with_carry(Ui128 first_addend, Ui128 second_addend,
 			unsigned char carry_in, unsigned char& carry_out) noexcept;
+
+		/// <summary>
+		/// The most characters to_chars can produce for a uint128 (i.e. 128 binary digits).
+		/// </summary>
+		constexpr size_t u128_max_chars = 128;
+
+		/// <summary>
+		/// Digits used by to_chars, in lowercase, for all bases up to 36.
+		/// </summary>
+		constexpr std::string_view u128_digit_chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+		/// <summary>
+		/// The largest power of a base that fits in a std::uint64_t, the number of digits
+		/// it spans and what is needed to divide by it without a hardware division.
+		/// </summary>
+		struct radix_chunk final
+		{
+			std::uint64_t divisor;
+			std::uint64_t reciprocal;
+			int digits;
+			int shift;
+		};
+
+		constexpr int radix_shift(int base) noexcept;
+
+		constexpr unsigned digit_value(char c) noexcept;
+
+		constexpr char* write_u64_digits_backward(char* end, std::uint64_t value,
+			std::uint64_t base, int min_digits) noexcept;
+
+		constexpr char* write_u128_pow2_digits_backward(char* end, uint128 value, int shift) noexcept;
+
+		constexpr char* write_u128_digits_backward(char* end, uint128 value, int base) noexcept;
+
+		constexpr bool multiply_add_u64(uint128& value, std::uint64_t multiplier, std::uint64_t addend) noexcept;
+
+		constexpr std::from_chars_result parse_u128_pow2_digits(const char* first, const char* last,
+			uint128& value, int shift) noexcept;
+
+		constexpr std::from_chars_result parse_u128_chunked_digits(const char* first, const char* last,
+			uint128& value, int base) noexcept;
+
+		/// <summary>
+		/// 10^19: the largest power of ten representable in a std::uint64_t.
+		/// </summary>
+		constexpr std::uint64_t u64_max_pow10 = 10'000'000'000'000'000'000ull;
+
+		constexpr uint128 full_multiply_u64(std::uint64_t multiplicand,
+			std::uint64_t multiplier) noexcept;
+
+		constexpr divmod_result<std::uint64_t> div_mod_2by1(std::uint64_t high, std::uint64_t low,
+			std::uint64_t divisor) noexcept;
+
+		constexpr std::uint64_t reciprocal_2by1(std::uint64_t normalized_divisor) noexcept;
+
+#ifdef CJM_GNU_X64_ASM_DIVQ_AVAILABLE
+		inline divmod_result<std::uint64_t> div_mod_2by1_divq(std::uint64_t high, std::uint64_t low,
+			std::uint64_t divisor) noexcept;
+#endif
+
+		constexpr divmod_result<std::uint64_t> div_mod_2by1_preinv(std::uint64_t high,
+			std::uint64_t low, std::uint64_t normalized_divisor, std::uint64_t reciprocal) noexcept;
+
+		constexpr divmod_result<uint128> div_mod_u64_max_pow10(uint128 dividend) noexcept;
+
+		constexpr divmod_result<uint128> div_mod_normalized_u64(uint128 dividend, std::uint64_t normalized_divisor,
+			std::uint64_t reciprocal, int shift) noexcept;
+
+		constexpr int count_decimal_digits(std::uint64_t value) noexcept;
+
+		constexpr char* write_u32_decimal_padded_backward(char* end, std::uint32_t value, int pairs) noexcept;
+
+		constexpr char* write_u64_decimal_backward(char* end, std::uint64_t value) noexcept;
+
+		constexpr char* write_u64_decimal_padded_backward(char* end, std::uint64_t value) noexcept;
+
+		constexpr char* write_u128_decimal_backward(char* end, uint128 value) noexcept;
+
+		/// <summary>
+		/// The number of hexadecimal digits in a fixed-width uint128.
+		/// </summary>
+		constexpr size_t u128_hex_digits = std::numeric_limits<std::uint64_t>::digits / 2;
+
+		constexpr int hex_digit_count(uint128 value) noexcept;
+
+		constexpr char* write_hex_fixed_scalar(char* first, uint128 value, bool upper_case) noexcept;
+
+		constexpr std::uint32_t hex_decode_fixed_scalar(const char* first, uint128& value) noexcept;
+
+		constexpr std::uint32_t hex_decode_fixed(const char* first, uint128& value) noexcept;
+
+		constexpr char* write_u128_hex_backward(char* end, uint128 value, bool upper_case) noexcept;
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+		//compiled for SSSE3 / AVX2 through a target attribute: only call them if
+		//can_use_ssse3() / can_use_avx2()
+		CJM_TARGET_SSSE3 inline void hex_encode_fixed_ssse3(char* first, uint128 value, bool upper_case) noexcept;
+
+		CJM_TARGET_SSSE3 inline std::uint32_t hex_decode_fixed_ssse3(const char* first, uint128& value) noexcept;
+
+		CJM_TARGET_AVX2 inline std::uint32_t hex_decode_fixed_avx2(const char* first, uint128& value) noexcept;
+#endif
+
+		constexpr std::uint64_t load_u64_little_endian(const char* first) noexcept;
+
+		constexpr bool is_eight_decimal_digits(std::uint64_t chunk) noexcept;
+
+		constexpr std::uint32_t parse_eight_decimal_digits(std::uint64_t chunk) noexcept;
+
+		constexpr const char* skip_decimal_digits(const char* first, const char* last) noexcept;
+
+		constexpr std::uint64_t parse_decimal_chunk(const char*& first, const char* last, std::ptrdiff_t max_digits) noexcept;
+
+		/// <summary>
+		/// The one set of rules for text holding a whole uint128: all zeros ("0", "00") is zero,
+		/// "0x" or "0X" followed by 1-32 hex digits is hexadecimal, any other leading zero is illegal
+		/// and everything else must be decimal digits that fit in 128 bits.
+		/// Every whole-text entry point (make_from_string, try_make_from_string, try_parse, operator>>
+		/// and parse_decimal_str/parse_hex_str) must end up here rather than
+		/// calling from_chars and friends directly: those keep std::from_chars semantics (leading
+		/// zeros accepted, no prefix, partial matches) and are the building blocks of this function.
+		/// </summary>
+		constexpr u128_parse_result parse_u128_text(std::string_view text) noexcept;
+
+		/// <summary>
+		/// A parsed std-format-spec for a uint128:
+		/// [[fill]align][sign]['#']['0'][width][type] where width may be a nested {} or {n}
+		/// and type is one of b, B, o, d, x or X.
+		/// </summary>
+		template<typename Char>
+		struct u128_format_spec final
+		{
+			Char fill = static_cast<Char>(' ');
+			char align = '\0';
+			char sign = '-';
+			bool alternate_form = false;
+			bool zero_pad = false;
+			size_t width = 0;
+			bool width_from_arg = false;
+			std::optional<size_t> width_arg_id;
+			char type = 'd';
+		};
+
+		/// <summary>
+		/// Parses a format spec from [first, last) into spec.
+		/// </summary>
+		/// <returns>the position of the closing brace (or last), nullptr if the spec is invalid.</returns>
+		template<typename Char>
+		constexpr const Char* parse_u128_format_spec(const Char* first, const Char* last,
+			u128_format_spec<Char>& spec) noexcept;
+
+		/// <summary>
+		/// Writes value to out as specified by spec (padded to width) through a stack buffer.
+		/// If negative, value is a magnitude and is written after a '-' whatever spec's sign.
+		/// </summary>
+		/// <returns>out, advanced past the characters written.</returns>
+		template<typename Char, std::output_iterator<const Char&> OutputIt>
+		constexpr OutputIt write_u128_formatted(OutputIt out, uint128 value,
+			const u128_format_spec<Char>& spec, size_t width, bool negative = false);
+#ifdef __cpp_lib_format
+		/// <summary>
+		/// Parses the format spec at the beginning of ctx into spec and, if its width
+		/// comes from an argument, checks or allocates that argument's id.
+		/// </summary>
+		/// <exception cref="std::format_error">the spec is invalid.</exception>
+		template<typename Char>
+		constexpr typename std::basic_format_parse_context<Char>::iterator parse_u128_format_context(
+			std::basic_format_parse_context<Char>& ctx, u128_format_spec<Char>& spec);
+
+		/// <summary>
+		/// The width spec calls for, read from ctx's arguments if it is not a literal.
+		/// </summary>
+		/// <exception cref="std::format_error">the width argument is not a non-negative integer.</exception>
+		template<typename Char, typename FormatContext>
+		size_t resolve_u128_format_width(const u128_format_spec<Char>& spec, FormatContext& ctx);
+#endif
+
+		template<typename Char>
+		constexpr Char* write_decimal_sequence(Char* out, std::span<const uint128> values,
+			std::span<const Char> separator, bool leading_separator) noexcept;
+
+		/// <summary>
+		/// How the batch operations taking max_threads (format_decimal, div_mod) split count values:
+		/// at most max_threads contiguous slices, and only as many as keep each slice at least
+		/// min_values_per_slice long.  Below that, starting a thread costs more than it saves.
+		/// </summary>
+		struct slice_plan final
+		{
+			static constexpr size_t min_values_per_slice = 32'768;
+
+			size_t count;
+			size_t slices;
+			size_t slice_size;
+
+			[[nodiscard]] constexpr size_t offset(size_t slice) const noexcept;
+
+			[[nodiscard]] constexpr size_t length(size_t slice) const noexcept;
+		};
+
+		constexpr slice_plan make_slice_plan(size_t count, unsigned max_threads) noexcept;
+
+		/// <summary>
+		/// Call slice_func(i) for every slice of plan and return once all are done: the first runs on the
+		/// calling thread, the rest on threads of their own.  slice_func may not throw, since an exception
+		/// leaving a worker would terminate the program.  If a thread cannot be started, its slice and
+		/// those after it run on the calling thread instead.
+		/// </summary>
+		template<typename SliceFunc>
+			requires std::is_nothrow_invocable_v<SliceFunc&, size_t>
+		void for_each_slice(const slice_plan& plan, SliceFunc slice_func);
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+		CJM_TARGET_SSSE3 inline bool try_parse_sixteen_decimal_digits_ssse3(const char* first, std::uint64_t& value) noexcept;
+#endif
 	}
 
 	/// <summary>
@@ -200,6 +434,156 @@ namespace cjm::numerics
 		requires cjm::numerics::concepts::char_with_traits<Char, CharTraits>
 	std::basic_istream<Char, CharTraits>& operator>>(std::basic_istream<Char, CharTraits>& is, uint128& v);
 
+	/// <summary>
+	/// Converts a uint128 into characters written to [first, last).  Follows the semantics
+	/// of std::to_chars for the builtin unsigned integers: no prefix, no padding, lowercase
+	/// letters for digits above 9.  Never allocates and never consults a locale.
+	/// </summary>
+	/// <param name="first">beginning of the destination range</param>
+	/// <param name="last">end of the destination range</param>
+	/// <param name="value">the value to convert</param>
+	/// <param name="base">the base to use: [2, 36]</param>
+	/// <returns>On success, ptr is one past the last character written and ec is value-initialized.
+	/// If the range is too small, ptr is last and ec is std::errc::value_too_large.  If base is
+	/// not in [2, 36], ptr is last and ec is std::errc::invalid_argument.</returns>
+	constexpr std::to_chars_result to_chars(char* first, char* last, uint128 value, int base = 10) noexcept;
+
+	/// <summary>
+	/// Parses a uint128 from [first, last).  Follows the semantics of std::from_chars for the
+	/// builtin unsigned integers: no whitespace skipping, no sign and no base prefix are accepted;
+	/// letters are accepted in either case.  Never allocates, never throws
+	/// and never consults a locale.
+	/// </summary>
+	/// <param name="first">beginning of the source range</param>
+	/// <param name="last">end of the source range</param>
+	/// <param name="value">receives the parsed value.  Unmodified on failure.</param>
+	/// <param name="base">the base to use: [2, 36]</param>
+	/// <returns>ptr points to the first character not matching the pattern.  ec is value-initialized
+	/// on success, std::errc::invalid_argument if no digits matched (ptr is then first) and
+	/// std::errc::result_out_of_range if the value does not fit in a uint128.</returns>
+	constexpr std::from_chars_result from_chars(const char* first, const char* last, uint128& value, int base = 10) noexcept;
+
+	/// <summary>
+	/// Counts the characters in the decimal representation of value.
+	/// </summary>
+	/// <param name="value">the value</param>
+	/// <returns>the number of decimal digits in value: [1, 39].</returns>
+	constexpr int decimal_digit_count(uint128 value) noexcept;
+
+	/// <summary>
+	/// Writes the decimal representation of value starting at first.  This is the
+	/// engine to_chars uses for base 10: it is constexpr, so it may be used to build
+	/// compile-time tables.  No bounds checking is performed.
+	/// </summary>
+	/// <param name="first">where to begin writing.  At least decimal_digit_count(value)
+	/// characters must be writable.</param>
+	/// <param name="value">the value to write</param>
+	/// <returns>one past the last character written.</returns>
+	constexpr char* write_decimal_unchecked(char* first, uint128 value) noexcept;
+
+	/// <summary>
+	/// Writes value as exactly 32 hexadecimal digits, zero-padded and most significant
+	/// digit first, starting at first.  Where SSSE3 is available, this is done in a single
+	/// vector pass.  No prefix is written and no bounds checking is performed.
+	/// </summary>
+	/// <param name="first">where to begin writing.  At least 32 characters must be writable.</param>
+	/// <param name="value">the value to write</param>
+	/// <param name="upper_case">true to use A-F, false to use a-f</param>
+	/// <returns>one past the last character written.</returns>
+	constexpr char* write_hex_fixed_unchecked(char* first, uint128 value, bool upper_case = false) noexcept;
+
+	/// <summary>
+	/// Writes value in hexadecimal using as few digits as possible (i.e. without leading zeros).
+	/// No prefix is written and no bounds checking is performed.
+	/// </summary>
+	/// <param name="first">where to begin writing.  At least 32 characters must be writable.</param>
+	/// <param name="value">the value to write</param>
+	/// <param name="upper_case">true to use A-F, false to use a-f</param>
+	/// <returns>one past the last character written.</returns>
+	constexpr char* write_hex_unchecked(char* first, uint128 value, bool upper_case = false) noexcept;
+
+	/// <summary>
+	/// Parses hexadecimal digits (no prefix, either case) from [first, last) with the semantics of
+	/// from_chars(first, last, value, 16).  Up to 32 digits are classified and converted in a single
+	/// vector pass where SSSE3 (or AVX2) is available.
+	/// </summary>
+	/// <param name="first">beginning of the source range</param>
+	/// <param name="last">end of the source range</param>
+	/// <param name="value">receives the parsed value.  Unmodified on failure.</param>
+	/// <returns>see from_chars.</returns>
+	constexpr std::from_chars_result from_hex_chars(const char* first, const char* last, uint128& value) noexcept;
+
+	/// <summary>
+	/// Parses decimal digits from [first, last) with the semantics of from_chars(first, last, value, 10)
+	/// in a single pass: eight digits at a time are validated and converted in a general purpose
+	/// register (sixteen at a time in a vector register where SSSE3 is available) and overflow is detected
+	/// from the digit count and one final comparison rather than by checking each digit.
+	/// </summary>
+	/// <param name="first">beginning of the source range</param>
+	/// <param name="last">end of the source range</param>
+	/// <param name="value">receives the parsed value.  Unmodified on failure.</param>
+	/// <returns>see from_chars.</returns>
+	constexpr std::from_chars_result from_decimal_chars(const char* first, const char* last, uint128& value) noexcept;
+
+	/// <summary>
+	/// The number of characters format_decimal produces for values when consecutive values
+	/// are separated by separator_length characters.
+	/// </summary>
+	/// <param name="values">the values</param>
+	/// <param name="separator_length">length of the separator</param>
+	/// <returns>the exact number of characters needed.</returns>
+	constexpr size_t formatted_decimal_length(std::span<const uint128> values, size_t separator_length) noexcept;
+
+	/// <summary>
+	/// Writes the decimal text of each of values to [first, last) with separator between
+	/// consecutive values: the same text as inserting each into a default-formatted stream.
+	/// </summary>
+	/// <param name="values">the values to write</param>
+	/// <param name="first">beginning of the destination range</param>
+	/// <param name="last">end of the destination range</param>
+	/// <param name="separator">written between consecutive values</param>
+	/// <returns>one past the last character written or, if formatted_decimal_length exceeds the
+	/// size of the range, {last, std::errc::value_too_large} having written nothing.</returns>
+	constexpr std::to_chars_result format_decimal(std::span<const uint128> values, char* first, char* last,
+		std::string_view separator) noexcept;
+
+	/// <summary>
+	/// Appends the decimal text of each of values to output with separator between consecutive
+	/// values: the same text as inserting each into a default-formatted stream.  The exact length
+	/// is computed first so output grows once; with max_threads greater than one, large spans are
+	/// split into slices formatted concurrently into their own regions of output.
+	/// </summary>
+	/// <typeparam name="Char">The Character type</typeparam>
+	/// <typeparam name="CharTraits">traits for character</typeparam>
+	/// <typeparam name="Allocator">allocator for character</typeparam>
+	/// <param name="values">the values to write</param>
+	/// <param name="output">the string to append to</param>
+	/// <param name="separator">written between consecutive values</param>
+	/// <param name="max_threads">the most threads to use, including the calling thread.</param>
+	/// <returns>output</returns>
+	template<typename Char = char, typename CharTraits = std::char_traits<Char>, typename Allocator = std::allocator<Char>>
+		requires cjm::numerics::concepts::char_with_traits_and_allocator<Char, CharTraits, Allocator>
+	std::basic_string<Char, CharTraits, Allocator>& format_decimal(std::span<const uint128> values,
+		std::basic_string<Char, CharTraits, Allocator>& output,
+		std::type_identity_t<std::basic_string_view<Char, CharTraits>> separator, unsigned max_threads = 1);
+
+	/// <summary>
+	/// Writes std::hash<uint128>{}(values[i]) to hashes[i] for every i.  hashes must be as long as
+	/// values.
+	/// </summary>
+	/// <param name="values">the values to hash</param>
+	/// <param name="hashes">receives the hashes</param>
+	constexpr void hash_batch(std::span<const uint128> values, std::span<size_t> hashes) noexcept;
+
+	/// <summary>
+	/// A hasher for unordered containers that need the hash earlier versions used for
+	/// std::hash<uint128> (e.g. to reproduce an iteration order).
+	/// </summary>
+	struct legacy_uint128_hash final
+	{
+		constexpr size_t operator()(const uint128& key_val) const noexcept;
+	};
+
 	constexpr std::uint64_t add_with_carry_u64(std::uint64_t addend_1, std::uint64_t addend_2, 
 		unsigned char carry_in, unsigned char& carry_out) noexcept;
 
@@ -241,6 +625,17 @@ namespace cjm::numerics
 		Hexadecimal
 	};
 
+	/// <summary>
+	/// Why text could not be parsed as a uint128.
+	/// </summary>
+	enum class u128_parse_error
+	{
+		None=0,
+		Empty,
+		Illegal,
+		Overflow
+	};
+
 	template<typename Chars, typename CharTraits = std::char_traits<Chars>>
 			  requires cjm::numerics::concepts::char_with_traits<Chars, CharTraits>
 	struct u128_parsing_helper final
@@ -323,7 +718,24 @@ namespace cjm::numerics
 			return trimmed;
 		}
 
+		/// <summary>
+		/// Parses decimal digits (leading zeros allowed) through
+		/// internal::parse_u128_text, throwing std::invalid_argument or std::overflow_error.
+		/// </summary>
 		static constexpr uint128 parse_decimal_str(sv decimal_str);
+
+		/// <summary>
+		/// Parses text accepted by uint128::make_from_string (surrounding whitespace, ',' and '_'
+		/// separators, decimal or 0x-prefixed hexadecimal) without throwing or allocating.
+		/// </summary>
+		/// <param name="text">the text to parse</param>
+		/// <returns>the value or the reason text could not be parsed.</returns>
+		static constexpr u128_parse_result try_parse(sv text) noexcept;
+
+		/// <summary>
+		/// Parses hexadecimal digits, with or without a 0x prefix, through
+		/// internal::parse_u128_text, throwing std::invalid_argument.
+		/// </summary>
 		static constexpr uint128 parse_hex_str(sv hex_str);
 	};
 
@@ -342,6 +754,25 @@ namespace std
 		constexpr size_t operator()(const cjm::numerics::uint128& keyVal) const noexcept;	  
 	};
 
+#ifdef __cpp_lib_format
+	/************************************************************************/
+	/* Lets std::format write uint128s directly to its output: supports fill,
+	 * alignment, sign, '#', '0', width (literal or from an argument) and the
+	 * presentation types b, B, o, d (the default), x and X.				*/
+	/************************************************************************/
+	template<typename Char>
+	struct formatter<cjm::numerics::uint128, Char>
+	{
+		constexpr typename basic_format_parse_context<Char>::iterator parse(basic_format_parse_context<Char>& ctx);
+
+		template<typename FormatContext>
+		typename FormatContext::iterator format(cjm::numerics::uint128 value, FormatContext& ctx) const;
+
+	private:
+		cjm::numerics::internal::u128_format_spec<Char> m_spec{};
+	};
+#endif
+
 	
 }
 
@@ -454,6 +885,35 @@ namespace cjm::numerics
 		static uint128 make_from_string(const std::basic_string<Chars, CharTraits,
 			Allocator>& parse_me);
 
+		/// <summary>
+		/// Parses a string_view into a uint128 accepting the same formats as make_from_string
+		/// but reporting failure through the result rather than by throwing.
+		/// </summary>
+		/// <typeparam name="Chars">Character type</typeparam>
+		/// <typeparam name="CharTraits">Character traits type</typeparam>
+		/// <param name="parse_me">the string_view to parse.</param>
+		/// <returns>the parsed value or the reason parsing failed.</returns>
+		template<typename Chars, typename CharTraits = std::char_traits<Chars>>
+		requires cjm::numerics::concepts::char_with_traits<Chars, CharTraits>
+			static constexpr u128_parse_result try_make_from_string(std::basic_string_view<Chars, CharTraits>
+				parse_me) noexcept;
+
+		/// <summary>
+		/// Parses a string into a uint128 accepting the same formats as make_from_string
+		/// but reporting failure through the result rather than by throwing.
+		/// </summary>
+		/// <typeparam name="Chars">Character type</typeparam>
+		/// <typeparam name="CharTraits">Character traits type</typeparam>
+		/// <typeparam name="Allocator">Allocator type</typeparam>
+		/// <param name="parse_me">the string to parse.</param>
+		/// <returns>the parsed value or the reason parsing failed.</returns>
+		template<typename Chars, typename CharTraits = std::char_traits<Chars>,
+			typename Allocator = std::allocator<Chars>>
+				requires cjm::numerics::concepts::char_with_traits_and_allocator<Chars,
+					CharTraits, Allocator>
+		static constexpr u128_parse_result try_make_from_string(const std::basic_string<Chars, CharTraits,
+			Allocator>& parse_me) noexcept;
+
 		/// <summary>
 		/// For future functionality -- will facilitate building addition operations
 		/// for a uint256 type.
@@ -607,7 +1067,17 @@ namespace cjm::numerics
 		}
 
 		//hash code function and comparison operators
+		/// <summary>
+		/// A wyhash-style pair of 64x64->128 bit multiply-folds: every bit of either limb affects
+		/// every bit of the result.  Define CJM_NUMERICS_UINT128_LEGACY_HASH to get
+		/// legacy_hash_code() here (and from std::hash) instead.
+		/// </summary>
 		[[nodiscard]] constexpr size_t hash_code() const noexcept;
+		/// <summary>
+		/// The hash_combine-style hash earlier versions used.  It is nearly linear in the low
+		/// limb, so keys that differ only in their high limbs collide in buckets: prefer hash_code.
+		/// </summary>
+		[[nodiscard]] constexpr size_t legacy_hash_code() const noexcept;
 			   
 		// Arithmetic operators.
 		friend constexpr uint128 operator+(uint128 lhs, uint128 rhs) noexcept;
@@ -655,6 +1125,7 @@ namespace cjm::numerics
 		friend uint128 internal::make_from_floating_point(TFloat v) noexcept;
 		
 		static constexpr size_t calculate_hash(int_part hi, int_part low) noexcept;
+		static constexpr size_t calculate_legacy_hash(int_part hi, int_part low) noexcept;
 		static constexpr void hash_combine(size_t& seed, size_t newVal) noexcept;
 		static constexpr uint128 make_from_bytes_native(byte_array b) noexcept;
 		static constexpr byte_array to_bytes_native(uint128 convert_me) noexcept; //NOLINT ((bugprone-exception-escape)
@@ -671,19 +1142,25 @@ namespace cjm::numerics
 			uint128 * quotient_ret, uint128 * remainder_ret) noexcept;
 		template<typename Char, typename CharTraits = std::char_traits<Char>,
 			typename Allocator = std::allocator<Char>>
-				requires (!cjm::numerics::concepts::utf_character<Char>)
-					&& (cjm::numerics::concepts::char_with_traits_and_allocator<Char, 
+				requires (cjm::numerics::concepts::char_with_traits_and_allocator<Char, 
 							CharTraits, Allocator>)
 		static std::basic_string<Char, CharTraits, Allocator>
 			to_string(uint128 item, std::ios_base::fmtflags flags);
-		template<typename Char, typename CharTraits = std::char_traits<Char>,
-			typename Allocator = std::allocator<Char>>
-				requires (cjm::numerics::concepts::utf_character<Char>)
-					&& (cjm::numerics::concepts::char_with_traits_and_allocator<Char,
-							CharTraits, Allocator>)
-		static std::basic_string<Char, CharTraits, Allocator> to_string(uint128 item,
-			std::ios_base::fmtflags flags);
+		/// <summary>
+		/// Writes item as it should appear in a stream formatted with flags (base, showbase
+		/// and uppercase are honored) such that the text ends immediately before end.
+		/// end must be preceded by at least internal::u128_max_chars writable characters.
+		/// </summary>
+		/// <returns>the beginning of the text written.</returns>
+		static char* write_stream_chars_backward(char* end, uint128 item,
+			std::ios_base::fmtflags flags) noexcept;
 
+	public:
+		/// <summary>
+		/// Implementation detail: use high_part() and low_part() instead.
+		/// The limbs are public only so that uint128 is a structural type and
+		/// may therefore be used as a non-type template argument (see div_by).
+		/// </summary>
 		fixed_uint_container::uint128_always_split_container_t m_limbs;
 	};
 
@@ -692,6 +1169,107 @@ namespace cjm::numerics
 	static_assert(!internal::validate_uint128_concept_compliance_dev || concepts::cjm_unsigned_integer<uint128>, "Needs to comply with cjm_unsigned_integer concept.");
 	static_assert(!internal::validate_uint128_concept_compliance_dev || concepts::integer<uint128>, "Needs to be an integer.");
 	static_assert(!internal::validate_uint128_concept_compliance_dev || concepts::printable_subtractable_totally_ordered<uint128>,"Needs to comply with printable_subtractable_totally_ordered.");
+
+	/// <summary>
+	/// The result of parsing text as a uint128 without throwing: the value
+	/// on success, otherwise the reason parsing failed.
+	/// </summary>
+	struct u128_parse_result final
+	{
+		std::optional<uint128> value;
+		u128_parse_error error = u128_parse_error::None;
+
+		constexpr explicit operator bool() const noexcept { return value.has_value(); }
+	};
+
+	/// <summary>
+	/// The result of dividing a uint128 by a std::uint64_t: the quotient may need all
+	/// 128 bits but the remainder, being less than the divisor, always fits in 64.
+	/// </summary>
+	struct u128_u64_divmod_result final
+	{
+		uint128 quotient;
+		std::uint64_t remainder;
+
+		friend constexpr bool operator==(const u128_u64_divmod_result& lhs,
+			const u128_u64_divmod_result& rhs) noexcept = default;
+	};
+
+	/// <summary>
+	/// Divide a uint128 by a std::uint64_t.  Cheaper than uint128::div_mod: on x64 it
+	/// is one or two hardware divide instructions (_udiv128 with MSVC, inline assembly with
+	/// GCC and Clang); elsewhere, and when constant evaluated, it multiplies by a
+	/// reciprocal of the divisor computed without dividing.
+	/// </summary>
+	/// <param name="dividend">the dividend</param>
+	/// <param name="divisor">the divisor</param>
+	/// <returns>the quotient and the remainder</returns>
+	/// <exception cref="std::domain_error">divisor is zero.</exception>
+	constexpr u128_u64_divmod_result div_mod_u64(uint128 dividend, std::uint64_t divisor);
+
+	/// <summary>
+	/// As div_mod_u64, but the divisor is not checked: if it is zero, the behavior is undefined.
+	/// </summary>
+	/// <param name="dividend">the dividend</param>
+	/// <param name="divisor">the divisor: must not be zero.</param>
+	/// <returns>the quotient and the remainder</returns>
+	constexpr u128_u64_divmod_result unsafe_div_mod_u64(uint128 dividend, std::uint64_t divisor) noexcept;
+
+	/// <summary>
+	/// The full 256-bit product of two uint128s, as its high and low halves.
+	/// </summary>
+	struct u128_wide_product final
+	{
+		uint128 high;
+		uint128 low;
+
+		friend constexpr bool operator==(const u128_wide_product& lhs,
+			const u128_wide_product& rhs) noexcept = default;
+	};
+
+	/// <summary>
+	/// Multiply without losing the high half of the product.  The four 64x64 partial
+	/// products use the native 128-bit type or _umul128/_mulx_u64 where available, and are
+	/// summed with add_with_carry (ADX with MSVC where available).
+	/// </summary>
+	/// <param name="multiplicand">the multiplicand</param>
+	/// <param name="multiplier">the multiplier</param>
+	/// <returns>the 256-bit product.  Its low half is multiplicand * multiplier.</returns>
+	constexpr u128_wide_product wide_multiply(uint128 multiplicand, uint128 multiplier) noexcept;
+
+	/// <summary>
+	/// The high half of the 256-bit product: wide_multiply(multiplicand, multiplier).high,
+	/// without the carries needed only by the low half.
+	/// </summary>
+	/// <param name="multiplicand">the multiplicand</param>
+	/// <param name="multiplier">the multiplier</param>
+	/// <returns>floor(multiplicand * multiplier / 2^128)</returns>
+	constexpr uint128 mulhi(uint128 multiplicand, uint128 multiplier) noexcept;
+
+	/// <summary>
+	/// The &lt;bit&gt; functions for uint128, with the semantics of their std:: namesakes
+	/// (e.g. countl_zero(0) is 128 and rotl by a negative count rotates right).
+	/// Each is composed from its 64-bit counterpart applied to the halves, which uses the
+	/// compiler builtin or intrinsic at runtime: see internal::countl_zero_u64.
+	/// </summary>
+	constexpr int popcount(uint128 value) noexcept;
+	constexpr int countl_zero(uint128 value) noexcept;
+	constexpr int countr_zero(uint128 value) noexcept;
+	constexpr int countl_one(uint128 value) noexcept;
+	constexpr int countr_one(uint128 value) noexcept;
+	constexpr int bit_width(uint128 value) noexcept;
+	constexpr bool has_single_bit(uint128 value) noexcept;
+	constexpr uint128 bit_floor(uint128 value) noexcept;
+	/// <summary>
+	/// The smallest power of two not less than value, which must be at most 2^127.
+	/// </summary>
+	constexpr uint128 bit_ceil(uint128 value) noexcept;
+	[[nodiscard]] constexpr uint128 rotl(uint128 value, int count) noexcept;
+	[[nodiscard]] constexpr uint128 rotr(uint128 value, int count) noexcept;
+	/// <summary>
+	/// Reverse the order of the sixteen bytes, as C++23's std::byteswap.
+	/// </summary>
+	constexpr uint128 byteswap(uint128 value) noexcept;
 }
 
 
@@ -707,9 +1285,8 @@ namespace cjm
 		namespace uint128_literals
 		{
 			/************************************************************************/
-			/* This literal operator accepts numeric literals in decimal or hexadecimal
-			 * format only.  Octal literals are not supported.  Binary literals 
-			 * are not supported now but support might be added.
+			/* This literal operator accepts numeric literals in decimal, hexadecimal
+			 * or binary format only.  Octal literals are not supported.
 			 * 
 			 * This literal operator supports character separators i.e. " ' "
 			 * 
@@ -733,6 +1310,7 @@ namespace cjm
 				Decimal = 1,
 				Hexadecimal = 2,
 				Zero = 3,
+				Binary = 4,
 			};
 
 			
@@ -793,6 +1371,9 @@ namespace cjm
 				template<char... Chars>
 				static CJM_LIT_CONST std::optional<size_t> count_decimal_chars();
 
+				template<char... Chars>
+				static CJM_LIT_CONST std::optional<uint128> parse_binary_literal();
+
 			public:
 
 				template<char... Chars>
@@ -48,6 +48,24 @@ constexpr size_t std::hash<cjm::numerics::uint128>::operator()(const cjm::numeri
 	return keyVal.hash_code();
 }
 
+#ifdef __cpp_lib_format
+template<typename Char>
+constexpr typename std::basic_format_parse_context<Char>::iterator
+	std::formatter<cjm::numerics::uint128, Char>::parse(std::basic_format_parse_context<Char>& ctx)
+{
+	return cjm::numerics::internal::parse_u128_format_context(ctx, m_spec);
+}
+
+template<typename Char>
+template<typename FormatContext>
+typename FormatContext::iterator std::formatter<cjm::numerics::uint128, Char>::format(cjm::numerics::uint128 value,
+	FormatContext& ctx) const
+{
+	const size_t width = cjm::numerics::internal::resolve_u128_format_width(m_spec, ctx);
+	return cjm::numerics::internal::write_u128_formatted(ctx.out(), value, m_spec, width);
+}
+#endif
+
 namespace cjm
 {
 	namespace numerics
@@ -62,7 +80,7 @@ namespace cjm
 			{
 				constexpr std::optional<uint128> result = uint128_literals::lit_helper::parse_literal<uint128,
 					Chars...>();
-				static_assert(result.has_value(), "This literal is not a valid decimal or hexadecimal uint128_t.");
+				static_assert(result.has_value(), "This literal is not a valid decimal, hexadecimal or binary uint128_t.");
 				return *result;
 			}
 		}
@@ -72,31 +90,64 @@ namespace cjm
 		{
 			using ios = std::basic_ios<Char, CharTraits>;
 			using iosflags = typename ios::fmtflags;
-			iosflags flags = os.flags();
-			auto rep = uint128::to_string<Char, CharTraits, Allocator>(v, flags);
+			typename std::basic_ostream<Char, CharTraits>::sentry sentry{ os };
+			if (!sentry)
+				return os;
+			const iosflags flags = os.flags();
+			std::array<char, internal::u128_max_chars> narrow{};
+			char* const end = narrow.data() + narrow.size();
+			char* const begin = uint128::write_stream_chars_backward(end, v, flags);
+			std::array<Char, internal::u128_max_chars> rep{};
+			std::transform(begin, end, rep.begin(), [](char c) -> Char { return static_cast<Char>(c); });
+			const auto rep_size = static_cast<std::streamsize>(end - begin);
+
 			std::streamsize width = os.width(0);
-			using str_size_t = std::remove_cvref_t<std::make_signed_t<decltype(rep.size())>>;
-			using common_type_t = std::common_type_t<str_size_t, std::streamsize>;
-			if (static_cast<common_type_t>(width) > static_cast<common_type_t>(rep.size()))
+			std::streamsize fill_before = 0;
+			std::streamsize prefix_size = 0;
+			std::streamsize fill_after_prefix = 0;
+			std::streamsize fill_after = 0;
+			if (width > rep_size)
 			{
-				const auto width_less_size = static_cast<str_size_t>(static_cast<common_type_t>(width)
-					- static_cast<common_type_t>(rep.size()));
+				const std::streamsize width_less_size = width - rep_size;
 				iosflags adjustfield = flags & ios::adjustfield;
 				if (adjustfield == ios::left)
 				{
-					rep.append(width_less_size, os.fill());
+					fill_after = width_less_size;
 				}
 				else if (adjustfield == ios::internal && (flags & ios::showbase)
 					&& (flags & ios::basefield) == ios::hex && v != 0)
 				{
-					rep.insert(2, width_less_size + 2, os.fill());
+					prefix_size = 2;
+					fill_after_prefix = width_less_size + 2;
 				}
 				else
 				{
-					rep.insert(0, width_less_size, os.fill());
+					fill_before = width_less_size;
 				}
 			}
-			return os << rep;
+
+			auto* const buffer = os.rdbuf();
+			//only consult fill when padding: it requires a ctype facet the utf streams may lack
+			auto put_fill = [buffer, &os](std::streamsize count) -> bool
+			{
+				const Char fill = count > 0 ? os.fill() : Char{};
+				for (; count > 0; --count)
+				{
+					if (CharTraits::eq_int_type(buffer->sputc(fill), CharTraits::eof()))
+						return false;
+				}
+				return true;
+			};
+			const bool written = put_fill(fill_before)
+				&& buffer->sputn(rep.data(), prefix_size) == prefix_size
+				&& put_fill(fill_after_prefix)
+				&& buffer->sputn(rep.data() + prefix_size, rep_size - prefix_size) == rep_size - prefix_size
+				&& put_fill(fill_after);
+			if (!written)
+			{
+				os.setstate(std::ios_base::badbit);
+			}
+			return os;
 		}
 
 		template <typename Char, typename CharTraits>
@@ -104,67 +155,132 @@ namespace cjm
 			std::basic_istream<Char, CharTraits>& operator>>(std::basic_istream<Char,
 				CharTraits>& is, uint128& v)
 		{
+			using int_type = typename CharTraits::int_type;
+			//only char and wchar_t have ctype facets: the sentry cannot skip whitespace for utf characters
+			constexpr bool has_ctype = std::is_same_v<Char, char> || std::is_same_v<Char, wchar_t>;
+			//tokens longer than this are never valid, but are still consumed like any other
+			constexpr size_t token_capacity = internal::u128_max_chars;
 			v = 0;
-			if (is.bad() || is.fail())
+			const bool skip_whitespace = (is.flags() & std::ios_base::skipws) != 0;
+			const typename std::basic_istream<Char, CharTraits>::sentry sentry{ is, !has_ctype || !skip_whitespace };
+			if (!sentry)
 			{
-				std::cerr << "Stream already in bad state upon attempt to extract uint128.";
-				is.setstate(std::ios_base::failbit | std::ios_base::badbit);
 				return is;
 			}
-			if (is.eof())
+
+			//ascii is classified directly; the stream's ctype facet is looked up only if something else shows up
+			const std::ctype<Char>* ctype = nullptr;
+			auto is_space = [&](Char c) -> bool
 			{
-				std::cerr << "Failed to extract uint128 from stream: already at eof.\n";
-				is.setstate(std::ios_base::failbit);
-			}
-			std::basic_string<Char, CharTraits> str;
-			if constexpr ((!cjm::numerics::is_windows) &&
-				cjm::numerics::concepts::utf_character<Char>)
+				const auto code = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<Char>>(c));
+				if (code < 0x80u)
+				{
+					return code == 0x20u || (code >= 0x09u && code <= 0x0du);
+				}
+				if constexpr (has_ctype)
+				{
+					if (ctype == nullptr)
+						ctype = &std::use_facet<std::ctype<Char>>(is.getloc());
+					return ctype->is(std::ctype_base::space, c);
+				}
+				else
+				{
+					return false;
+				}
+			};
+
+			//the token is narrowed while it is read: anything outside ascii cannot be part of a number
+			std::ios_base::iostate state = std::ios_base::goodbit;
+			std::array<char, token_capacity> token{};
+			std::string long_token;
+			size_t length = 0;
+			bool all_decimal = true;
+			const size_t max_length = is.width() > 0 ? static_cast<size_t>(is.width()) : std::numeric_limits<size_t>::max();
+			try
 			{
-				Char c{};
-				do
+				auto* const buffer = is.rdbuf();
+				int_type next = buffer->sgetc();
+				if constexpr (!has_ctype)
 				{
-					if (is.good() && !is.eof() && is.peek() != CharTraits::eof())
+					while (skip_whitespace && !CharTraits::eq_int_type(next, CharTraits::eof())
+						&& is_space(CharTraits::to_char_type(next)))
 					{
-						is.get(c);
-						if (!is.bad() && !is.fail())
-						{
-							if (!std::isspace<char>(
-								static_cast<char>(static_cast<unsigned char>(c)), std::locale("")))
-								str.push_back(c);
-							else
-								break;
-						}
+						next = buffer->snextc();
 					}
-					else
+				}
+				for (; length < max_length; next = buffer->snextc())
+				{
+					if (CharTraits::eq_int_type(next, CharTraits::eof()))
+					{
+						state |= std::ios_base::eofbit;
 						break;
-				} while (!is.bad() && !is.fail() && !is.eof());
-				if (is.bad() || is.fail())
+					}
+					const Char wide = CharTraits::to_char_type(next);
+					if (is_space(wide))
+						break;
+					const auto code = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<Char>>(wide));
+					const char c = code < 0x80u ? static_cast<char>(code) : '\0';
+					all_decimal = all_decimal && c >= '0' && c <= '9';
+					if (length < token.size())
+					{
+						token[length] = c;
+					}
+					else
+					{
+						if (long_token.empty())
+							long_token.assign(token.data(), token.size());
+						long_token.push_back(c);
+					}
+					++length;
+				}
+			}
+			catch (...)
+			{
+				//like the standard extractors: record badbit, and rethrow the buffer's exception if badbit is in the mask
+				is.width(0);
+				if ((is.exceptions() & std::ios_base::badbit) == 0)
 				{
+					is.setstate(std::ios_base::badbit);
 					return is;
 				}
-				if (str.empty())
+				try
 				{
-					is.setstate(std::ios_base::failbit);
-					return is;
+					is.setstate(std::ios_base::badbit);
 				}
+				catch (const std::ios_base::failure&)
+				{
+				}
+				throw;
 			}
-			else
-			{
-				is >> str;
-			}
+			is.width(0);
 
-			if (is.bad() || is.fail())
+			bool failed = length == 0;
+			if (!failed)
 			{
-				return is;
-			}
-			try
-			{
-				v = uint128::make_from_string(str);
-				return is;
+				if (all_decimal && length <= token.size())
+				{
+					//plain decimal digits, the common case: no whitespace or separators to strip,
+					//but parse_u128_text still has to apply its leading zero rule
+					if (const auto result = internal::parse_u128_text(std::string_view{ token.data(), length }); result)
+						v = *result.value;
+					else
+						failed = true;
+				}
+				else
+				{
+					const auto text = length <= token.size()
+						? std::string_view{ token.data(), length }
+						: std::string_view{ long_token };
+					if (const auto result = u128_parsing_helper<char>::try_parse(text); result)
+						v = *result.value;
+					else
+						failed = true;
+				}
 			}
-			catch (const std::exception& ex)
+			is.setstate(state);
+			if (failed)
 			{
-				std::cerr << "Error parsing stream to uint128: [" << ex.what() << "].\n";
+				//throws std::ios_base::failure if failbit is in the stream's exception mask
 				is.setstate(std::ios_base::failbit);
 			}
 			return is;
@@ -173,113 +289,46 @@ namespace cjm
 
 
 		template<typename Char, typename CharTraits, typename Allocator>
-		requires (cjm::numerics::concepts::utf_character<Char>) &&
-			(cjm::numerics::concepts::char_with_traits_and_allocator<Char,
-				CharTraits, Allocator>)
-			std::basic_string<Char, CharTraits, Allocator> uint128::to_string(uint128 item,
-				std::ios_base::fmtflags flags)
-		{
-			if constexpr (is_windows)
-			{
-				constexpr char zero_char_temp = '0';
-				constexpr Char zero_char = static_cast<Char>(zero_char_temp);
-				uint128 div;
-				int div_base_log;
-				switch (flags & std::basic_ios<Char, CharTraits>::basefield)
-				{
-				case std::basic_ios<Char, CharTraits>::hex:
-					div = 0x1000000000000000;  // 16^15
-					div_base_log = 15;
-					break;
-				case std::basic_ios<Char, CharTraits>::oct:
-					div = 01000000000000000000000;  // 8^21
-					div_base_log = 21;
-					break;
-				default:  // std::ios::dec
-					div = 10000000000000000000u;  // 10^19
-					div_base_log = 19;
-					break;
-				}
-				std::basic_stringstream<Char, CharTraits, Allocator> os;
-				std::ios_base::fmtflags copyMask = std::basic_ios<Char, CharTraits>::basefield | std::basic_ios<Char,
-					CharTraits>::showbase | std::basic_ios<Char, CharTraits>::uppercase;
-				os.setf(flags & copyMask, copyMask);
-				uint128 high = item;
-				uint128 low = 0;
-				best_safe_div_mod(high, div, &high, &low);
-				uint128 mid = 0;
-				best_safe_div_mod(high, div, &high, &mid);
-				if (high.low_part() != 0)
-				{
-					os << high.low_part();
-					os << std::noshowbase << std::setfill(zero_char) << std::setw(div_base_log);
-					os << mid.low_part();
-					os << std::setw(div_base_log);
-				}
-				else if (mid.low_part() != 0)
-				{
-					os << mid.low_part();
-					os << std::noshowbase << std::setfill(zero_char) << std::setw(div_base_log);
-				}
-				os << low.low_part();
-				return os.str();
-			}
-			else //cludge for linux and clang which aren't nice enough to provide facets for the utf strings
-			{
-				std::string converted_narrow = uint128::to_string<char, std::char_traits<char>, std::allocator<char>>(item, flags);
-				std::basic_string<Char, CharTraits, Allocator> ret;
-				ret.reserve(converted_narrow.size());
-				std::transform(converted_narrow.cbegin(), converted_narrow.cend(), std::back_inserter(ret), [](char c) -> Char {return static_cast<Char>(c); });
-				return ret;
-			}
+		requires (cjm::numerics::concepts::char_with_traits_and_allocator<Char, CharTraits, Allocator>)
+			std::basic_string<Char, CharTraits, Allocator> uint128::to_string(uint128 item, std::ios_base::fmtflags flags)
+		{
+			std::array<char, internal::u128_max_chars> buffer{};
+			char* const end = buffer.data() + buffer.size();
+			char* const begin = write_stream_chars_backward(end, item, flags);
+			std::basic_string<Char, CharTraits, Allocator> ret;
+			ret.reserve(static_cast<size_t>(end - begin));
+			std::transform(begin, end, std::back_inserter(ret), [](char c) -> Char {return static_cast<Char>(c); });
+			return ret;
 		}
 
-		template<typename Char, typename CharTraits, typename Allocator>
-		requires (!cjm::numerics::concepts::utf_character<Char>) &&
-			(cjm::numerics::concepts::char_with_traits_and_allocator<Char, CharTraits, Allocator>)
-			std::basic_string<Char, CharTraits, Allocator> uint128::to_string(uint128 item, std::ios_base::fmtflags flags)
+		inline char* uint128::write_stream_chars_backward(char* end, uint128 item,
+			std::ios_base::fmtflags flags) noexcept
 		{
-			constexpr char zero_char_temp = '0';
-			constexpr Char zero_char = static_cast<Char>(zero_char_temp);
-			uint128 div;
-			int div_base_log;
-			switch (flags & std::basic_ios<Char, CharTraits>::basefield)
+			char* begin;
+			const bool show_base = (flags & std::ios_base::showbase) && item != 0;
+			const bool upper_case = static_cast<bool>(flags & std::ios_base::uppercase);
+			switch (flags & std::ios_base::basefield)
 			{
-			case std::basic_ios<Char, CharTraits>::hex:
-				div = 0x1000000000000000;  // 16^15
-				div_base_log = 15;
+			case std::ios_base::hex:
+				begin = internal::write_u128_hex_backward(end, item, upper_case);
+				if (show_base)
+				{
+					*--begin = upper_case ? 'X' : 'x';
+					*--begin = '0';
+				}
 				break;
-			case std::basic_ios<Char, CharTraits>::oct:
-				div = 01000000000000000000000;  // 8^21
-				div_base_log = 21;
+			case std::ios_base::oct:
+				begin = internal::write_u128_digits_backward(end, item, 8);
+				if (show_base)
+				{
+					*--begin = '0';
+				}
 				break;
 			default:  // std::ios::dec
-				div = 10000000000000000000u;  // 10^19
-				div_base_log = 19;
+				begin = internal::write_u128_digits_backward(end, item, 10);
 				break;
 			}
-			std::basic_stringstream<Char, CharTraits, Allocator> os;
-			std::ios_base::fmtflags copyMask = std::basic_ios<Char, CharTraits>::basefield | std::basic_ios<Char, CharTraits>::showbase | std::basic_ios<Char, CharTraits>::uppercase;
-			os.setf(flags & copyMask, copyMask);
-			uint128 high = item;
-			uint128 low = 0;
-			best_safe_div_mod(high, div, &high, &low);
-			uint128 mid = 0;
-			best_safe_div_mod(high, div, &high, &mid);
-			if (high.low_part() != 0)
-			{
-				os << high.low_part();
-				os << std::noshowbase << std::setfill(zero_char) << std::setw(div_base_log);
-				os << mid.low_part();
-				os << std::setw(div_base_log);
-			}
-			else if (mid.low_part() != 0)
-			{
-				os << mid.low_part();
-				os << std::noshowbase << std::setfill(zero_char) << std::setw(div_base_log);
-			}
-			os << low.low_part();
-			return os.str();
+			return begin;
 		}
 
 		constexpr uint128 uint128::make_from_bytes_little_endian(byte_array bytes) noexcept
@@ -481,27 +530,28 @@ namespace cjm
 		requires cjm::numerics::concepts::char_with_traits<Chars, CharTraits>
 			uint128 uint128::make_from_string(std::basic_string_view<Chars, CharTraits> parse_me)
 		{
-			using ph = u128_parsing_helper<Chars, CharTraits>;
-			auto str = std::basic_string<Chars, CharTraits>{ parse_me };
-			auto trimmed = ph::trim_and_strip(str);
-			auto parseFormat = ph::get_format(trimmed);
-			uint128 ret;
-			switch (parseFormat)
+			const auto result = try_make_from_string(parse_me);
+			if (!result)
 			{
-			default:
-			case u128_str_format::Illegal:
+				if (result.error == u128_parse_error::Overflow)
+					throw std::overflow_error("The string represents a number too large to parse as a uint128.");
 				throw std::invalid_argument("Unable to parse a uint128 from the supplied string.");
-			case u128_str_format::Zero:
-				ret = 0;
-				break;
-			case u128_str_format::Decimal:
-				ret = ph::parse_decimal_str(trimmed);
-				break;
-			case u128_str_format::Hexadecimal:
-				ret = ph::parse_hex_str(trimmed);
-				break;
 			}
-			return ret;
+			return *result.value;
+		}
+
+		template<typename Chars, typename CharTraits, typename Allocator>
+		requires cjm::numerics::concepts::char_with_traits_and_allocator<Chars, CharTraits, Allocator>
+			constexpr u128_parse_result uint128::try_make_from_string(const std::basic_string<Chars, CharTraits, Allocator>& parse_me) noexcept
+		{
+			return try_make_from_string(std::basic_string_view<Chars, CharTraits>{parse_me});
+		}
+
+		template<typename Chars, typename CharTraits>
+		requires cjm::numerics::concepts::char_with_traits<Chars, CharTraits>
+			constexpr u128_parse_result uint128::try_make_from_string(std::basic_string_view<Chars, CharTraits> parse_me) noexcept
+		{
+			return u128_parsing_helper<Chars, CharTraits>::try_parse(parse_me);
 		}
 		constexpr uint128::operator bool() const noexcept
 		{
@@ -564,7 +614,16 @@ namespace cjm
 
 		constexpr size_t uint128::hash_code() const noexcept
 		{
+#ifdef CJM_NUMERICS_UINT128_LEGACY_HASH
+			return calculate_legacy_hash(m_limbs.m_high, m_limbs.m_low);
+#else
 			return calculate_hash(m_limbs.m_high, m_limbs.m_low);
+#endif
+		}
+
+		constexpr size_t uint128::legacy_hash_code() const noexcept
+		{
+			return calculate_legacy_hash(m_limbs.m_high, m_limbs.m_low);
 		}
 
 		constexpr uint128& uint128::operator+=(uint128 other) noexcept
@@ -745,6 +804,30 @@ namespace cjm
 			: m_limbs{ high, low } {}
 
 		constexpr size_t uint128::calculate_hash(int_part hi, int_part low) noexcept
+		{
+			static_assert(sizeof(size_t) == 8 || sizeof(size_t) == 4, "Only 32 and 64 bit architecture supported.");
+			//wyhash's mixing for a 16 byte key, applied to the limbs: two 64x64->128 bit
+			//multiplies, each folded by xoring the halves of the product.
+			constexpr std::uint64_t secret_0 = 0xa076'1d64'78bd'642f;
+			constexpr std::uint64_t secret_1 = 0xe703'7ed1'a0b4'28db;
+			constexpr std::uint64_t key_length = 16;
+			//the folded product of the two secrets, as wyhash derives it for a zero seed
+			constexpr std::uint64_t seed = 0x1ff5'c292'3a78'8d2c;
+			const uint128 product = internal::full_multiply_u64(low ^ secret_1, hi ^ seed);
+			const uint128 mixed = internal::full_multiply_u64(product.low_part() ^ secret_0 ^ key_length,
+				product.high_part() ^ secret_1);
+			const std::uint64_t hash = mixed.low_part() ^ mixed.high_part();
+			if constexpr (sizeof(size_t) == 8)
+			{
+				return static_cast<size_t>(hash);
+			}
+			else // ReSharper disable once CppUnreachableCode
+			{
+				return static_cast<size_t>(hash ^ (hash >> 32));
+			}
+		}
+
+		constexpr size_t uint128::calculate_legacy_hash(int_part hi, int_part low) noexcept
 		{
 			static_assert(sizeof(size_t) == 8 || sizeof(size_t) == 4, "Only 32 and 64 bit architecture supported.");
 			size_t hash{ 0 };
@@ -913,6 +996,48 @@ namespace cjm
 			return ret;
 		}
 
+		namespace internal
+		{
+			constexpr divmod_result<std::uint64_t> div_mod_2by1(std::uint64_t high, std::uint64_t low,
+				std::uint64_t divisor) noexcept
+			{
+				// Knuth's algorithm D on 32-bit digits (Hacker's Delight, divlu): two quotient digits,
+				// each estimated from the normalized divisor's top digit and corrected at most twice.
+				assert(high < divisor);
+				constexpr int limb_bits = std::numeric_limits<std::uint64_t>::digits;
+				constexpr int digit_bits = limb_bits / 2;
+				constexpr std::uint64_t digit_base = std::uint64_t{ 1 } << digit_bits;
+				constexpr std::uint64_t digit_mask = digit_base - 1;
+				const int shift = std::countl_zero(divisor);
+				divisor <<= shift;
+				const std::uint64_t divisor_high = divisor >> digit_bits;
+				const std::uint64_t divisor_low = divisor & digit_mask;
+				const std::uint64_t top = shift == 0 ? high : (high << shift) | (low >> (limb_bits - shift));
+				low <<= shift;
+				const std::uint64_t low_high = low >> digit_bits;
+				const std::uint64_t low_low = low & digit_mask;
+
+				auto estimate = [=](std::uint64_t numerator, std::uint64_t next_digit) -> std::uint64_t
+				{
+					std::uint64_t digit = numerator / divisor_high;
+					std::uint64_t partial = numerator - digit * divisor_high;
+					while (digit >= digit_base || digit * divisor_low > ((partial << digit_bits) | next_digit))
+					{
+						--digit;
+						partial += divisor_high;
+						if (partial >= digit_base)
+							break;
+					}
+					return digit;
+				};
+				const std::uint64_t quotient_high = estimate(top, low_high);
+				const std::uint64_t middle = (top << digit_bits) + low_high - quotient_high * divisor;
+				const std::uint64_t quotient_low = estimate(middle, low_low);
+				const std::uint64_t remainder = (middle << digit_bits) + low_low - quotient_low * divisor;
+				return divmod_result<std::uint64_t>{ (quotient_high << digit_bits) | quotient_low, remainder >> shift };
+			}
+		}
+
 		constexpr void uint128::constexpr_div_mod_impl(uint128 dividend, uint128 divisor,
 			uint128* quotient_ret, uint128* remainder_ret)
 		{
@@ -928,44 +1053,42 @@ namespace cjm
 			uint128* quotient_ret, uint128* remainder_ret) noexcept
 		{
 			assert(divisor != 0);
-			// Long division/modulo for uint128 implemented using the shift-subtract
-		   // division algorithm adapted from:
-		   // https://stackoverflow.com/questions/5386377/division-without-using
+			// Long division on 64-bit limbs: Knuth, TAOCP vol. 2, 4.3.1, algorithm D.
+			// Each quotient limb comes from a normalized 2-by-1 estimate
+			// rather than from one shift-subtract step per quotient bit.
 			if (divisor > dividend)
 			{
 				*quotient_ret = 0;
 				*remainder_ret = dividend;
 				return;
 			}
-			if (divisor == dividend)
+			if (divisor.m_limbs.m_high == 0)
 			{
-				*quotient_ret = 1;
-				*remainder_ret = 0;
+				const auto [quotient, remainder] = unsafe_div_mod_u64(dividend, divisor.m_limbs.m_low);
+				*quotient_ret = quotient;
+				*remainder_ret = remainder;
 				return;
 			}
 
-			uint128 denominator = divisor;
-			uint128 quotient = 0;
-
-			// Left aligns the MSB of the denominator and the dividend.
-			const int shift = fls(dividend) - fls(denominator);
-			denominator <<= shift;
-
-			// Uses shift-subtract algorithm to divide dividend by denominator. The
-			// remainder will be left in dividend.
-			for (int i = 0; i <= shift; ++i)
+			// The quotient fits in one limb.  Halving the dividend keeps the estimate from
+			// overflowing; after scaling back it is exact or one too large (Hacker's Delight, 9-5).
+			const int shift = std::countl_zero(divisor.m_limbs.m_high);
+			const std::uint64_t divisor_top = (divisor << shift).m_limbs.m_high;
+			const uint128 halved = dividend >> 1;
+			std::uint64_t quotient = internal::div_mod_2by1(halved.m_limbs.m_high, halved.m_limbs.m_low,
+				divisor_top).quotient >> (std::numeric_limits<std::uint64_t>::digits - 1 - shift);
+			if (quotient != 0)
 			{
-				quotient <<= 1;
-				if (dividend >= denominator)
-				{
-					dividend -= denominator;
-					quotient |= 1;
-				}
-				denominator >>= 1;
+				--quotient;
+			}
+			uint128 remainder = dividend - uint128{ quotient } * divisor;
+			if (remainder >= divisor)
+			{
+				++quotient;
+				remainder -= divisor;
 			}
-
 			*quotient_ret = quotient;
-			*remainder_ret = dividend;
+			*remainder_ret = remainder;
 		}
 
 		constexpr int uint128::fls(uint128 n)  noexcept
@@ -992,15 +1115,81 @@ namespace cjm
 			return std::countl_zero(n);
 		}
 
-		constexpr int internal::countl_zero(uint128 n) noexcept
+		constexpr int internal::countl_zero_u64(std::uint64_t n) noexcept
 		{
-			assert(n != 0);
-			auto hp = n.high_part();
-			if (hp != 0)
+			if (std::is_constant_evaluated())
+			{
+				return std::countl_zero(n);
+			}
+			else
+			{
+#if defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)
+				return n == 0 ? std::numeric_limits<std::uint64_t>::digits : __builtin_clzll(n);
+#elif defined(CJM_BASE_INTRINSICS_AVAILABLE)
+				unsigned long index = 0;
+				return CJM_BITSCAN_REV_64(&index, n) != 0 ? 63 - static_cast<int>(index) : std::numeric_limits<std::uint64_t>::digits;
+#else
+				return std::countl_zero(n);
+#endif
+			}
+		}
+
+		constexpr int internal::countr_zero_u64(std::uint64_t n) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return std::countr_zero(n);
+			}
+			else
+			{
+#if defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)
+				return n == 0 ? std::numeric_limits<std::uint64_t>::digits : __builtin_ctzll(n);
+#elif defined(CJM_BASE_INTRINSICS_AVAILABLE)
+				unsigned long index = 0;
+				return CJM_BITSCAN_FWD_64(&index, n) != 0 ? static_cast<int>(index) : std::numeric_limits<std::uint64_t>::digits;
+#else
+				return std::countr_zero(n);
+#endif
+			}
+		}
+
+		constexpr int internal::popcount_u64(std::uint64_t n) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return std::popcount(n);
+			}
+			else
+			{
+				//Microsoft's std::popcount already checks for the popcnt instruction at runtime
+#if defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)
+				return __builtin_popcountll(n);
+#else
+				return std::popcount(n);
+#endif
+			}
+		}
+
+		constexpr std::uint64_t internal::byteswap_u64(std::uint64_t n) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				n = ((n & 0x00ff'00ff'00ff'00ff) << 8) | ((n >> 8) & 0x00ff'00ff'00ff'00ff);
+				n = ((n & 0x0000'ffff'0000'ffff) << 16) | ((n >> 16) & 0x0000'ffff'0000'ffff);
+				return (n << 32) | (n >> 32);
+			}
+			else
 			{
-				return std::countl_zero(hp);
+#if defined(CJM_DETECTED_GCC) || defined(CJM_DETECTED_CLANG)
+				return __builtin_bswap64(n);
+#elif defined(CJM_BASE_INTRINSICS_AVAILABLE)
+				return CJM_BYTESWAP_64(n);
+#else
+				n = ((n & 0x00ff'00ff'00ff'00ff) << 8) | ((n >> 8) & 0x00ff'00ff'00ff'00ff);
+				n = ((n & 0x0000'ffff'0000'ffff) << 16) | ((n >> 16) & 0x0000'ffff'0000'ffff);
+				return (n << 32) | (n >> 32);
+#endif
 			}
-			return std::numeric_limits<uint128::int_part>::digits + std::countl_zero(n.low_part());
 		}
 
 		template <typename T>
@@ -1456,8 +1645,7 @@ namespace cjm
 			{
 				if constexpr (constexpr_bit_casting)
 				{
-					auto lz = internal::countl_zero(bit_cast<natuint128_t>(value));
-					return static_cast<int>(std::numeric_limits<natuint128_t>::digits - 1 - lz);
+					return std::numeric_limits<uint128>::digits - 1 - countl_zero(value);
 				}
 				else
 				{
@@ -1476,12 +1664,9 @@ namespace cjm
 			using int_t = typename uint128::int_part;
 			if (std::is_constant_evaluated())
 			{
-				int_t ret = lhs;
-				int_t max = std::max(lhs, rhs);
-				if (carry_in)
-					++ret;
-				ret += rhs;
-				carry_out = ret < max ? 1 : 0;
+				const int_t sum = lhs + rhs;
+				const int_t ret = sum + (carry_in ? 1 : 0);
+				carry_out = static_cast<unsigned char>((sum < lhs) | (ret < sum));
 				return ret;
 			}
 			else
@@ -1494,14 +1679,18 @@ namespace cjm
 					carry_out = CJM_ADDCARRY64(carry_in, lhs, rhs, &ret);
 					return ret;
 				}
+				else if constexpr (calculation_mode == uint128_calc_mode::intrinsic_u128)
+				{
+					//compiles to add/adc: lets chains of these (e.g. fixed_uint's limbs) stay in the carry flag
+					const natuint128_t sum = static_cast<natuint128_t>(lhs) + rhs + carry_in;
+					carry_out = static_cast<unsigned char>(sum >> std::numeric_limits<int_t>::digits);
+					return static_cast<int_t>(sum);
+				}
 				else
 				{
-					int_t ret = lhs;
-					int_t max = std::max(lhs, rhs);
-					if (carry_in)
-						++ret;
-					ret += rhs;
-					carry_out = ret < max ? 1 : 0;
+					const int_t sum = lhs + rhs;
+					const int_t ret = sum + (carry_in ? 1 : 0);
+					carry_out = static_cast<unsigned char>((sum < lhs) | (ret < sum));
 					return ret;
 				}
 			}
@@ -1520,11 +1709,9 @@ namespace cjm
 		{
 			if (std::is_constant_evaluated())
 			{
-				uint128 ret = first_addend;
-				if (carry_in)
-					++ret;
-				ret += second_addend;
-				unsigned char carry_out = ret < first_addend;
+				const uint128 sum = first_addend + second_addend;
+				const uint128 ret = sum + (carry_in ? 1 : 0);
+				const auto carry_out = static_cast<unsigned char>((sum < first_addend) | (ret < sum));
 				return std::make_pair(ret, carry_out);
 			}
 			else
@@ -1549,11 +1736,9 @@ namespace cjm
 				}
 				else
 				{
-					uint128 ret = first_addend;
-					if (carry_in)
-						++ret;
-					ret += second_addend;
-					unsigned char carry_out = ret < first_addend;
+					const uint128 sum = first_addend + second_addend;
+					const uint128 ret = sum + (carry_in ? 1 : 0);
+					const auto carry_out = static_cast<unsigned char>((sum < first_addend) | (ret < sum));
 					return std::make_pair(ret, carry_out);
 				}
 			}
@@ -1565,14 +1750,10 @@ namespace cjm
 			using int_t = typename uint128::int_part;
 			if (std::is_constant_evaluated())
 			{
-				int_t ret = minuend;
-				if (borrow_in)
-				{
-					--ret;
-				}
-				ret -= subtrahend;
-				borrow_out = ret > minuend ? 0 : 1;
-				return ret;
+				const int_t difference = minuend - subtrahend;
+				const int_t borrow = borrow_in ? 1 : 0;
+				borrow_out = static_cast<unsigned char>((minuend < subtrahend) | (difference < borrow));
+				return difference - borrow;
 			}
 			else
 			{
@@ -1583,16 +1764,19 @@ namespace cjm
 					borrow_out = CJM_SUBBORROW_64(borrow_in, minuend, subtrahend, &ret);
 					return ret;
 				}
+				else if constexpr (calculation_mode == uint128_calc_mode::intrinsic_u128)
+				{
+					//a borrow out of the low limb leaves the high limb all ones
+					const natuint128_t difference = static_cast<natuint128_t>(minuend) - subtrahend - borrow_in;
+					borrow_out = static_cast<unsigned char>((difference >> std::numeric_limits<int_t>::digits) != 0);
+					return static_cast<int_t>(difference);
+				}
 				else
 				{
-					int_t ret = minuend;
-					if (borrow_in)
-					{
-						--ret;
-					}
-					ret -= subtrahend;
-					borrow_out = ret > minuend ? 0 : 1;
-					return ret;
+					const int_t difference = minuend - subtrahend;
+					const int_t borrow = borrow_in ? 1 : 0;
+					borrow_out = static_cast<unsigned char>((minuend < subtrahend) | (difference < borrow));
+					return difference - borrow;
 				}
 			}
 		}
@@ -1603,12 +1787,10 @@ namespace cjm
 		{
 			if (std::is_constant_evaluated())
 			{
-				uint128 ret = minuend;
-				if (borrow_in)
-					--ret;
-				ret -= subtrahend;
-				unsigned char borrow_out = ret > minuend ? 1 : 0;
-				return std::make_pair(ret, borrow_out);
+				const uint128 difference = minuend - subtrahend;
+				const uint128 borrow = borrow_in ? 1 : 0;
+				const auto borrow_out = static_cast<unsigned char>((minuend < subtrahend) | (difference < borrow));
+				return std::make_pair(difference - borrow, borrow_out);
 			}
 			else
 			{
@@ -1634,12 +1816,10 @@ namespace cjm
 				}
 				else
 				{
-					uint128 ret = minuend;
-					if (borrow_in)
-						--ret;
-					ret -= subtrahend;
-					unsigned char borrow_out = ret > minuend ? 1 : 0;
-					return std::make_pair(ret, borrow_out);
+					const uint128 difference = minuend - subtrahend;
+					const uint128 borrow = borrow_in ? 1 : 0;
+					const auto borrow_out = static_cast<unsigned char>((minuend < subtrahend) | (difference < borrow));
+					return std::make_pair(difference - borrow, borrow_out);
 				}
 			}
 		}
@@ -2367,120 +2547,1542 @@ requires cjm::numerics::concepts::char_with_traits<Chars, CharTraits>
 constexpr  cjm::numerics::uint128 cjm::numerics::u128_parsing_helper<Chars, CharTraits>::
 parse_decimal_str(sv decimal_str)
 {
-	uint128 ret = 0;
-	uint128 exp = 1;
-	for (auto i = decimal_str.length() - 1; i != std::numeric_limits<size_t>::max(); --i)
+	//leading zeros were always accepted here, unlike parse_u128_text
+	constexpr char_t zero = static_cast<char_t>('0');
+	decimal_str.remove_prefix(std::min(decimal_str.find_first_not_of(zero), decimal_str.size()));
+	if (decimal_str.empty())
+	{
+		return 0;
+	}
+	if (decimal_str.size() > internal::u128_max_chars)
 	{
-		auto oldRet = ret;
-		ret += static_cast<uint128>(get_value_dec(decimal_str[i])) * exp;
-		if (oldRet > ret)
-			throw std::overflow_error("The string represents a number too large to parse as a uint128.");
-		exp *= 10;
+		throw std::invalid_argument{ "Supplied string contains too many characters to be a uint128." };
 	}
-	return ret;
+	std::array<char, internal::u128_max_chars> narrow{};
+	std::transform(decimal_str.cbegin(), decimal_str.cend(), narrow.begin(), [](char_t c) -> char
+	{
+		const auto code = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<char_t>>(c));
+		return code < 0x80u ? static_cast<char>(code) : '\0';
+	});
+	const auto [value, error] = internal::parse_u128_text(std::string_view{ narrow.data(), decimal_str.size() });
+	if (error == u128_parse_error::Overflow)
+	{
+		throw std::overflow_error{ "The string represents a number too large to parse as a uint128." };
+	}
+	if (!value.has_value())
+	{
+		throw std::invalid_argument{ "Supplied string contains characters that are not decimal digits." };
+	}
+	return *value;
 }
 
+template<typename Chars, typename CharTraits>
+requires cjm::numerics::concepts::char_with_traits<Chars, CharTraits>
+constexpr cjm::numerics::u128_parse_result cjm::numerics::u128_parsing_helper<Chars, CharTraits>::
+try_parse(sv text) noexcept
+{
+	auto code_of = [](char_t c) -> std::uint32_t
+	{
+		return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<char_t>>(c));
+	};
+	auto is_space = [=](char_t c) -> bool
+	{
+		const std::uint32_t code = code_of(c);
+		return code == 0x20u || (code >= 0x09u && code <= 0x0du);
+	};
+	constexpr sv separators = non_decimal_separator();
+	size_t begin = 0;
+	size_t end = text.size();
+	while (begin < end && is_space(text[begin]))
+		++begin;
+	while (end > begin && is_space(text[end - 1]))
+		--end;
+
+	//drop separators while narrowing: anything outside ascii cannot be part of a number
+	std::array<char, internal::u128_max_chars> narrow{};
+	size_t length = 0;
+	bool all_zero = true;
+	bool all_decimal = true;
+	for (size_t i = begin; i < end; ++i)
+	{
+		if (separators.find(text[i]) != sv::npos)
+			continue;
+		const std::uint32_t code = code_of(text[i]);
+		const char c = code < 0x80u ? static_cast<char>(code) : '\0';
+		all_zero = all_zero && c == '0';
+		all_decimal = all_decimal && c >= '0' && c <= '9';
+		if (length < narrow.size())
+			narrow[length] = c;
+		++length;
+	}
+	if (length > narrow.size())
+	{
+		//longer than any text that can fit: zero, too big or not a number
+		if (all_zero)
+			return u128_parse_result{ uint128{}, u128_parse_error::None };
+		return u128_parse_result{ std::nullopt, all_decimal && narrow[0] != '0'
+			? u128_parse_error::Overflow : u128_parse_error::Illegal };
+	}
+	return internal::parse_u128_text(std::string_view{ narrow.data(), length });
+}
 
 template<typename Chars, typename CharTraits>
 requires cjm::numerics::concepts::char_with_traits<Chars, CharTraits>
 constexpr  cjm::numerics::uint128 cjm::numerics::u128_parsing_helper<Chars, CharTraits>::
 parse_hex_str(sv hex_str)
 {
-	constexpr char zero = '0';
-	constexpr char_t zero_cast = static_cast<char_t>(zero);
-	auto length = hex_str.length();
-
-	if (length < 1)
+	constexpr char_t zero = static_cast<char_t>('0');
+	if (hex_str.empty())
 	{
 		throw std::invalid_argument{ "Cannot parse supplied string as 128-bit unsigned integer: string is empty." };
 	}
-	bool allZero = std::all_of(hex_str.cbegin(), hex_str.cend(), [](char_t c) -> bool
+	const auto hex_tags = get_hex_tags();
+	if (hex_str.size() >= 2 && std::any_of(hex_tags.cbegin(), hex_tags.cend(),
+		[=](sv tag) -> bool {return tag == hex_str.substr(0, 2); }))
+	{
+		hex_str.remove_prefix(2);
+		if (hex_str.empty())
 		{
-			return c == zero_cast;
-		});
-	if (hex_str[0] == zero_cast && (length == 1 || allZero))
+			throw std::invalid_argument{ "Supplied string contains no valid hexadecimal digits." };
+		}
+	}
+	hex_str.remove_prefix(std::min(hex_str.find_first_not_of(zero), hex_str.size()));
+	if (hex_str.empty())
 	{
 		return 0;
 	}
-	if (length == 2)
+	if (hex_str.size() > internal::u128_hex_digits)
 	{
-		uint8_t high_nibble = get_value_hex(hex_str[0]) << (CHAR_BIT / 2);
-		uint8_t low_nibble = get_value_hex(hex_str[1]);
-		return high_nibble | low_nibble;
+		throw std::invalid_argument{ "Supplied string contains too many hex digits to store in uint128." };
 	}
-	else
+	//parse_u128_text wants the prefix back
+	std::array<char, internal::u128_hex_digits + 2> narrow{ '0', 'x' };
+	std::transform(hex_str.cbegin(), hex_str.cend(), narrow.begin() + 2, [](char_t c) -> char
+	{
+		const auto code = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<char_t>>(c));
+		return code < 0x80u ? static_cast<char>(code) : '\0';
+	});
+	const auto [value, error] = internal::parse_u128_text(std::string_view{ narrow.data(), hex_str.size() + 2 });
+	if (!value.has_value())
+	{
+		throw std::invalid_argument{ "Supplied string contains characters that are not hexadecimal digits." };
+	}
+	return *value;
+}
+
+namespace cjm::numerics
+{
+	constexpr std::to_chars_result to_chars(char* first, char* last, uint128 value, int base) noexcept
 	{
-		using namespace numerics::uint128_literals;
-		const auto first_two = hex_str.substr(0, 2);
-		const auto hex_tags = get_hex_tags();
-		const bool has_hex_tags = std::any_of(hex_tags.cbegin(), hex_tags.cend(),
-			[=](sv tag) -> bool {return tag == first_two; });
-		if (has_hex_tags)
+		if (base < 2 || base > 36)
 		{
-			hex_str = hex_str.substr(2, hex_str.size() - 2);
+			return std::to_chars_result{ last, std::errc::invalid_argument };
 		}
-		size_t hex_digits = std::count_if(hex_str.cbegin(), hex_str.cend(),
-			[](char_t c) -> bool
-			{
-				return is_legal_hex_char(c);
-			});
-		if (hex_digits < 1)
+		std::array<char, internal::u128_max_chars> buffer{};
+		char* const end = buffer.data() + buffer.size();
+		char* const begin = internal::write_u128_digits_backward(end, value, base);
+		const auto length = end - begin;
+		if (last - first < length)
 		{
-			throw std::invalid_argument{ "Supplied string contains no valid hexadecimal digits." };
+			return std::to_chars_result{ last, std::errc::value_too_large };
 		}
+		return std::to_chars_result{ std::copy(begin, end, first), std::errc{} };
+	}
 
-		constexpr size_t max_hex_digits = std::numeric_limits<uint128>::digits / (CHAR_BIT / 2); //max of 32 hex digits
-
-		if (hex_digits > max_hex_digits)
+	constexpr std::from_chars_result from_chars(const char* first, const char* last, uint128& value, int base) noexcept
+	{
+		if (base < 2 || base > 36)
 		{
-			throw std::invalid_argument{ "Supplied string contains too many hex digits to store in uint128." };
+			return std::from_chars_result{ first, std::errc::invalid_argument };
 		}
-
-		const size_t shift_result_right_amount = (max_hex_digits - hex_digits) * 4u;
-		//nb. removed vector and just use array.  not only vector not necessary, but clang can't handle in constexpr context yet
-		auto arr = (uint128{}).to_big_endian_arr(); //get an empty zero-filled array
-		size_t idx = 0;
-
-		while (!hex_str.empty()) //i.e. more bytes to go
+		if (base == 10)
+		{
+			return from_decimal_chars(first, last, value);
+		}
+		if (base == 16)
+		{
+			return from_hex_chars(first, last, value);
+		}
+		if (const int shift = internal::radix_shift(base); shift != 0)
 		{
-			//get next byte and the remainder of the string not incl byte we just got
-			//if no more bytes, new_hex_str will be empty.
-			auto [byte, new_hex_str] = get_value_hex(hex_str);
-			hex_str = new_hex_str;
-			arr[idx++] = byte;
+			return internal::parse_u128_pow2_digits(first, last, value, shift);
 		}
-		return (uint128::make_from_bytes_big_endian(arr) >> shift_result_right_amount);
+		return internal::parse_u128_chunked_digits(first, last, value, base);
 	}
-}
 
-namespace cjm::numerics::internal
-{
-	template<concepts::builtin_floating_point TFloat>
-	uint128 make_from_floating_point(TFloat v) noexcept
+	namespace internal
 	{
-		using flt_t = std::remove_cvref_t<TFloat>;
-		if constexpr (std::is_same_v<flt_t, long double> && !sse3_available &&
-			// ReSharper disable once CppRedundantBooleanExpressionArgument
-			(compiler == compiler_used::clang || compiler == compiler_used::clang_gcc))
+		constexpr std::array<char, 200> decimal_digit_pairs = []() -> std::array<char, 200>
 		{
-			// Go 50 bits at a time, that fits in a double
-			static_assert(std::numeric_limits<double>::digits >= 50, "double digits must >= 50");
-			static_assert(std::numeric_limits<long double>::digits <= 150, "long double digits must <= 150.");
-			// Undefined behavior if v is not finite or cannot fit into uint128.
-			assert(std::isfinite(v) && v > -1 && v < std::ldexp(1.0L, 128));
+			std::array<char, 200> ret{};
+			for (size_t i = 0; i < 100; ++i)
+			{
+				ret[i * 2] = static_cast<char>('0' + i / 10);
+				ret[i * 2 + 1] = static_cast<char>('0' + i % 10);
+			}
+			return ret;
+		}();
 
-			v = std::ldexp(v, -100);
-			const auto w0 = static_cast<std::uint64_t>(static_cast<double>(std::trunc(v)));
-			v = std::ldexp(v - static_cast<double>(w0), 50);
-			const auto w1 = static_cast<std::uint64_t>(static_cast<double>(std::trunc(v)));
-			v = std::ldexp(v - static_cast<double>(w1), 50);
-			const auto w2 = static_cast<std::uint64_t>(static_cast<double>(std::trunc(v)));
-			return (static_cast<uint128>(w0) << 100) | (static_cast<uint128>(w1) << 50) |
-				static_cast<uint128>(w2);
-		}
-		else
+		constexpr std::array<std::uint64_t, std::numeric_limits<std::uint64_t>::digits10 + 1> u64_powers_of_ten
+			= []() -> std::array<std::uint64_t, std::numeric_limits<std::uint64_t>::digits10 + 1>
 		{
-
+			std::array<std::uint64_t, std::numeric_limits<std::uint64_t>::digits10 + 1> ret{};
+			std::uint64_t power = 1;
+			for (auto& entry : ret)
+			{
+				entry = power;
+				power *= 10;
+			}
+			return ret;
+		}();
+
+		constexpr std::array<uint128, std::numeric_limits<uint128>::digits10 + 1> u128_powers_of_ten
+			= []() -> std::array<uint128, std::numeric_limits<uint128>::digits10 + 1>
+		{
+			std::array<uint128, std::numeric_limits<uint128>::digits10 + 1> ret{};
+			uint128 power = 1;
+			for (auto& entry : ret)
+			{
+				entry = power;
+				power *= 10;
+			}
+			return ret;
+		}();
+
+		constexpr uint128 full_multiply_u64(std::uint64_t multiplicand, std::uint64_t multiplier) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return uint128{ multiplicand } * uint128{ multiplier };
+			}
+			else
+			{
+				if constexpr (calculation_mode == uint128_calc_mode::intrinsic_u128)
+				{
+					return static_cast<natuint128_t>(multiplicand) * multiplier;
+				}
+				else if constexpr (calculation_mode == uint128_calc_mode::msvc_x64 || calculation_mode == uint128_calc_mode::msvc_x64_clang_or_intel_llvm)
+				{
+					std::uint64_t high = 0;
+					const std::uint64_t low = CJM_UMUL128(multiplicand, multiplier, &high);
+					return uint128::make_uint128(high, low);
+				}
+				else
+				{	// constexpr (calculation_mode == uint128_calc_mode::default_eval)
+					return uint128{ multiplicand } * uint128{ multiplier };
+				}
+			}
+		}
+
+		/// <summary>
+		/// floor((2^19 - 3 * 2^8) / d9) for each d9 in [2^8, 2^9): the 11-bit seed of reciprocal_2by1.
+		/// </summary>
+		constexpr std::array<std::uint16_t, 256> reciprocal_seeds = []() -> std::array<std::uint16_t, 256>
+		{
+			std::array<std::uint16_t, 256> ret{};
+			for (std::uint32_t i = 0; i < ret.size(); ++i)
+			{
+				ret[i] = static_cast<std::uint16_t>(((1u << 19) - 3u * (1u << 8)) / (i + 256u));
+			}
+			return ret;
+		}();
+
+		constexpr std::uint64_t reciprocal_2by1(std::uint64_t normalized_divisor) noexcept
+		{
+			//floor((2^128 - 1) / d) - 2^64 without dividing: Moller & Granlund, "Improved division
+			//by invariant integers", algorithm 3.  A table seed refined by Newton iterations.
+			assert((normalized_divisor >> (std::numeric_limits<std::uint64_t>::digits - 1)) == 1);
+			const std::uint64_t d = normalized_divisor;
+			const std::uint64_t d0 = d & 1;
+			const std::uint64_t d9 = d >> 55;
+			const std::uint64_t d40 = (d >> 24) + 1;
+			const std::uint64_t d63 = (d >> 1) + d0;
+			const std::uint64_t v0 = reciprocal_seeds[d9 - 256];
+			const std::uint64_t v1 = (v0 << 11) - ((v0 * v0 * d40) >> 40) - 1;
+			const std::uint64_t v2 = (v1 << 13) + ((v1 * ((std::uint64_t{ 1 } << 60) - v1 * d40)) >> 47);
+			//the remaining steps are modulo 2^64
+			const std::uint64_t e = ((v2 >> 1) & (std::uint64_t{} - d0)) - v2 * d63;
+			const std::uint64_t v3 = (v2 << 31) + (full_multiply_u64(v2, e).high_part() >> 1);
+			const uint128 product = full_multiply_u64(v3, d) + uint128::make_uint128(d, d);
+			return v3 - product.high_part();
+		}
+
+#ifdef CJM_GNU_X64_ASM_DIVQ_AVAILABLE
+		inline divmod_result<std::uint64_t> div_mod_2by1_divq(std::uint64_t high, std::uint64_t low,
+			std::uint64_t divisor) noexcept
+		{
+			assert(high < divisor);
+			std::uint64_t quotient;
+			std::uint64_t remainder;
+			__asm__("divq %[divisor]" : "=a"(quotient), "=d"(remainder) : [divisor] "rm"(divisor), "a"(low), "d"(high));
+			return divmod_result<std::uint64_t>{ quotient, remainder };
+		}
+#endif
+
+		constexpr divmod_result<std::uint64_t> div_mod_2by1_preinv(std::uint64_t high, std::uint64_t low,
+			std::uint64_t normalized_divisor, std::uint64_t reciprocal) noexcept
+		{
+			//Moller & Granlund, "Improved division by invariant integers", algorithm 4.
+			assert(high < normalized_divisor);
+			const uint128 estimate = full_multiply_u64(reciprocal, high) + uint128::make_uint128(high, low);
+			std::uint64_t quotient = estimate.high_part() + 1;
+			std::uint64_t remainder = low - quotient * normalized_divisor;
+			//this adjustment is taken about as often as not: keep it free of branches
+			const std::uint64_t mask = std::uint64_t{} - static_cast<std::uint64_t>(remainder > estimate.low_part());
+			quotient += mask;
+			remainder += mask & normalized_divisor;
+			if (remainder >= normalized_divisor)
+			{
+				++quotient;
+				remainder -= normalized_divisor;
+			}
+			return divmod_result<std::uint64_t>{ quotient, remainder };
+		}
+
+		constexpr divmod_result<uint128> div_mod_u64_max_pow10(uint128 dividend) noexcept
+		{
+			constexpr std::uint64_t divisor = u64_max_pow10;
+			constexpr std::uint64_t reciprocal = reciprocal_2by1(divisor);
+			static_assert((divisor >> (std::numeric_limits<std::uint64_t>::digits - 1)) == 1,
+				"10^19 is normalized: the high limb's quotient is either zero or one.");
+			const bool high_quotient = dividend.high_part() >= divisor;
+			const std::uint64_t high_remainder = high_quotient ? dividend.high_part() - divisor : dividend.high_part();
+			const auto [low_quotient, remainder] = div_mod_2by1_preinv(high_remainder, dividend.low_part(),
+				divisor, reciprocal);
+			return divmod_result<uint128>{ uint128::make_uint128(high_quotient ? 1u : 0u, low_quotient), remainder };
+		}
+
+		constexpr divmod_result<uint128> div_mod_normalized_u64(uint128 dividend, std::uint64_t normalized_divisor,
+			std::uint64_t reciprocal, int shift) noexcept
+		{
+			//shift the dividend along with the divisor: the top limb is then always less than the divisor
+			constexpr int limb_bits = std::numeric_limits<std::uint64_t>::digits;
+			assert(shift >= 0 && shift < limb_bits && (normalized_divisor >> (limb_bits - 1)) == 1);
+			const std::uint64_t top = shift == 0 ? 0 : dividend.high_part() >> (limb_bits - shift);
+			const std::uint64_t high = shift == 0 ? dividend.high_part()
+				: (dividend.high_part() << shift) | (dividend.low_part() >> (limb_bits - shift));
+			const std::uint64_t low = dividend.low_part() << shift;
+			const auto [high_quotient, high_remainder] = div_mod_2by1_preinv(top, high, normalized_divisor, reciprocal);
+			const auto [low_quotient, remainder] = div_mod_2by1_preinv(high_remainder, low, normalized_divisor, reciprocal);
+			return divmod_result<uint128>{ uint128::make_uint128(high_quotient, low_quotient), remainder >> shift };
+		}
+
+		constexpr int count_decimal_digits(std::uint64_t value) noexcept
+		{
+			//value | 1 has the same number of digits as value and is never zero
+			//log10(2) ~= 1233 / 4096: guess is either the digit count or one less
+			value |= 1u;
+			const int guess = (std::bit_width(value) * 1233) >> 12;
+			return guess + (value >= u64_powers_of_ten[static_cast<size_t>(guess)] ? 1 : 0);
+		}
+
+		constexpr char* write_u32_decimal_padded_backward(char* end, std::uint32_t value, int pairs) noexcept
+		{
+			for (int i = 0; i < pairs; ++i)
+			{
+				const auto pair = static_cast<size_t>(value % 100u) * 2;
+				value /= 100u;
+				*--end = decimal_digit_pairs[pair + 1];
+				*--end = decimal_digit_pairs[pair];
+			}
+			return end;
+		}
+
+		constexpr char* write_u64_decimal_backward(char* end, std::uint64_t value) noexcept
+		{
+			//eight digit groups are written with 32-bit arithmetic
+			constexpr std::uint64_t group_divisor = 100'000'000u;
+			while (value >= group_divisor)
+			{
+				end = write_u32_decimal_padded_backward(end, static_cast<std::uint32_t>(value % group_divisor), 4);
+				value /= group_divisor;
+			}
+			auto remaining = static_cast<std::uint32_t>(value);
+			while (remaining >= 100u)
+			{
+				const auto pair = static_cast<size_t>(remaining % 100u) * 2;
+				remaining /= 100u;
+				*--end = decimal_digit_pairs[pair + 1];
+				*--end = decimal_digit_pairs[pair];
+			}
+			if (remaining >= 10u)
+			{
+				const auto pair = static_cast<size_t>(remaining) * 2;
+				*--end = decimal_digit_pairs[pair + 1];
+				*--end = decimal_digit_pairs[pair];
+			}
+			else
+			{
+				*--end = static_cast<char>('0' + remaining);
+			}
+			return end;
+		}
+
+		constexpr char* write_u64_decimal_padded_backward(char* end, std::uint64_t value) noexcept
+		{
+			assert(value < u64_max_pow10);
+			//19 digits: two independent groups of eight and a leading group of three
+			constexpr std::uint64_t group_divisor = 100'000'000u;
+			const std::uint64_t upper = value / group_divisor;
+			const auto lowest_group = static_cast<std::uint32_t>(value % group_divisor);
+			const auto middle_group = static_cast<std::uint32_t>(upper % group_divisor);
+			const auto top_group = static_cast<std::uint32_t>(upper / group_divisor);
+			end = write_u32_decimal_padded_backward(end, lowest_group, 4);
+			end = write_u32_decimal_padded_backward(end, middle_group, 4);
+			end = write_u32_decimal_padded_backward(end, top_group % 100u, 1);
+			*--end = static_cast<char>('0' + top_group / 100u);
+			return end;
+		}
+
+		constexpr char* write_u128_decimal_backward(char* end, uint128 value) noexcept
+		{
+			if (value.high_part() != 0)
+			{
+				const auto [upper, lowest_chunk] = div_mod_u64_max_pow10(value);
+				end = write_u64_decimal_padded_backward(end, lowest_chunk.low_part());
+				if (upper.high_part() != 0)
+				{
+					const auto [top, middle_chunk] = div_mod_u64_max_pow10(upper);
+					end = write_u64_decimal_padded_backward(end, middle_chunk.low_part());
+					return write_u64_decimal_backward(end, top.low_part());
+				}
+				return write_u64_decimal_backward(end, upper.low_part());
+			}
+			return write_u64_decimal_backward(end, value.low_part());
+		}
+
+		constexpr std::string_view u128_upper_hex_digit_chars = "0123456789ABCDEF";
+
+		constexpr std::uint8_t invalid_hex_nibble = 0xff;
+
+		constexpr std::array<std::uint8_t, 256> hex_nibble_values = []() -> std::array<std::uint8_t, 256>
+		{
+			std::array<std::uint8_t, 256> ret{};
+			for (size_t i = 0; i < ret.size(); ++i)
+			{
+				if (i >= '0' && i <= '9')
+					ret[i] = static_cast<std::uint8_t>(i - '0');
+				else if (i >= 'a' && i <= 'f')
+					ret[i] = static_cast<std::uint8_t>(i - 'a' + 10);
+				else if (i >= 'A' && i <= 'F')
+					ret[i] = static_cast<std::uint8_t>(i - 'A' + 10);
+				else
+					ret[i] = invalid_hex_nibble;
+			}
+			return ret;
+		}();
+
+		constexpr int hex_digit_count(uint128 value) noexcept
+		{
+			return value == 0 ? 1 : (std::numeric_limits<uint128>::digits - countl_zero(value) + 3) / 4;
+		}
+
+		constexpr char* write_hex_fixed_scalar(char* first, uint128 value, bool upper_case) noexcept
+		{
+			const std::string_view digits = upper_case ? u128_upper_hex_digit_chars : u128_digit_chars;
+			constexpr size_t limb_digits = u128_hex_digits / 2;
+			std::uint64_t high = value.high_part();
+			std::uint64_t low = value.low_part();
+			for (size_t i = 1; i <= limb_digits; ++i, high >>= 4, low >>= 4)
+			{
+				first[limb_digits - i] = digits[static_cast<size_t>(high & 0x0f)];
+				first[u128_hex_digits - i] = digits[static_cast<size_t>(low & 0x0f)];
+			}
+			return first + u128_hex_digits;
+		}
+
+		constexpr std::uint32_t hex_decode_fixed_scalar(const char* first, uint128& value) noexcept
+		{
+			constexpr size_t limb_digits = u128_hex_digits / 2;
+			std::uint32_t valid_mask = 0;
+			std::uint64_t high = 0;
+			std::uint64_t low = 0;
+			for (size_t i = 0; i < limb_digits; ++i)
+			{
+				const std::uint8_t high_nibble = hex_nibble_values[static_cast<unsigned char>(first[i])];
+				const std::uint8_t low_nibble = hex_nibble_values[static_cast<unsigned char>(first[i + limb_digits])];
+				valid_mask |= (high_nibble != invalid_hex_nibble ? 1u : 0u) << i;
+				valid_mask |= (low_nibble != invalid_hex_nibble ? 1u : 0u) << (i + limb_digits);
+				high = (high << 4) | (high_nibble & 0x0fu);
+				low = (low << 4) | (low_nibble & 0x0fu);
+			}
+			value = uint128::make_uint128(high, low);
+			return valid_mask;
+		}
+
+		constexpr std::uint32_t hex_decode_fixed(const char* first, uint128& value) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return hex_decode_fixed_scalar(first, value);
+			}
+			else
+			{
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+				if (can_use_avx2())
+				{
+					return hex_decode_fixed_avx2(first, value);
+				}
+				if (can_use_ssse3())
+				{
+					return hex_decode_fixed_ssse3(first, value);
+				}
+#endif
+				return hex_decode_fixed_scalar(first, value);
+			}
+		}
+
+		constexpr char* write_u128_hex_backward(char* end, uint128 value, bool upper_case) noexcept
+		{
+			char* const begin = end - hex_digit_count(value);
+			write_hex_unchecked(begin, value, upper_case);
+			return begin;
+		}
+
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+		CJM_TARGET_SSSE3 inline void hex_encode_fixed_ssse3(char* first, uint128 value, bool upper_case) noexcept
+		{
+			const __m128i reverse_bytes = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+			const __m128i digits = upper_case
+				? _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F')
+				: _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+			const __m128i most_significant_first = _mm_shuffle_epi8(_mm_set_epi64x(
+				static_cast<long long>(value.high_part()), static_cast<long long>(value.low_part())), reverse_bytes);
+			const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(most_significant_first, 4), nibble_mask);
+			const __m128i low_nibbles = _mm_and_si128(most_significant_first, nibble_mask);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(first),
+				_mm_shuffle_epi8(digits, _mm_unpacklo_epi8(high_nibbles, low_nibbles)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(first + u128_hex_digits / 2),
+				_mm_shuffle_epi8(digits, _mm_unpackhi_epi8(high_nibbles, low_nibbles)));
+		}
+
+		CJM_TARGET_SSSE3 inline std::uint32_t hex_decode_fixed_ssse3(const char* first, uint128& value) noexcept
+		{
+			//digits and (case-folded) letters a-f are each a single unsigned range check
+			auto to_nibbles = [](__m128i chars, __m128i& nibbles) -> std::uint32_t
+			{
+				const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+				const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+				const __m128i letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+				const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+				nibbles = _mm_or_si128(_mm_and_si128(is_digit, digit),
+					_mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)));
+			};
+			__m128i high_nibbles;
+			__m128i low_nibbles;
+			std::uint32_t valid_mask = to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), high_nibbles);
+			valid_mask |= to_nibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + u128_hex_digits / 2)),
+				low_nibbles) << 16;
+			//(high nibble * 16) + low nibble for each adjacent pair, then narrow back to bytes
+			const __m128i nibble_weights = _mm_set1_epi16(0x0110);
+			const __m128i most_significant_first = _mm_packus_epi16(_mm_maddubs_epi16(high_nibbles, nibble_weights),
+				_mm_maddubs_epi16(low_nibbles, nibble_weights));
+			const __m128i reverse_bytes = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			std::array<std::uint64_t, 2> limbs{};
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(limbs.data()), _mm_shuffle_epi8(most_significant_first, reverse_bytes));
+			value = uint128::make_uint128(limbs[1], limbs[0]);
+			return valid_mask;
+		}
+
+		CJM_TARGET_AVX2 inline std::uint32_t hex_decode_fixed_avx2(const char* first, uint128& value) noexcept
+		{
+			//all 32 characters are classified and converted in one register
+			const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+			const __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+			const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+			const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+			const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+			const __m256i nibbles = _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+				_mm256_and_si256(is_letter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+			const __m256i bytes = _mm256_maddubs_epi16(nibbles, _mm256_set1_epi16(0x0110));
+			//packing works within 128-bit lanes: gather the low quadword of each lane
+			const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0b00'00'10'00);
+			const __m128i reverse_bytes = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			std::array<std::uint64_t, 2> limbs{};
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(limbs.data()),
+				_mm_shuffle_epi8(_mm256_castsi256_si128(packed), reverse_bytes));
+			value = uint128::make_uint128(limbs[1], limbs[0]);
+			return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)));
+		}
+#endif
+
+		constexpr std::uint64_t load_u64_little_endian(const char* first) noexcept
+		{
+			if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+			{
+				std::uint64_t ret;
+				std::memcpy(&ret, first, sizeof(ret));
+				return ret;
+			}
+			std::uint64_t ret = 0;
+			for (size_t i = 0; i < sizeof(ret); ++i)
+			{
+				ret |= static_cast<std::uint64_t>(static_cast<unsigned char>(first[i])) << (i * CHAR_BIT);
+			}
+			return ret;
+		}
+
+		constexpr bool is_eight_decimal_digits(std::uint64_t chunk) noexcept
+		{
+			//every byte must be 0x30-0x39: high nibble 3 and adding 6 must not carry into it
+			return ((chunk & 0xf0f0'f0f0'f0f0'f0f0ull)
+				| (((chunk + 0x0606'0606'0606'0606ull) & 0xf0f0'f0f0'f0f0'f0f0ull) >> 4))
+				== 0x3333'3333'3333'3333ull;
+		}
+
+		constexpr std::uint32_t parse_eight_decimal_digits(std::uint64_t chunk) noexcept
+		{
+			//first character in the low byte: combine adjacent digits into pairs, then pairs into
+			//the 8-digit value with two multiplications
+			constexpr std::uint64_t mask = 0x0000'00ff'0000'00ffull;
+			constexpr std::uint64_t mul1 = 0x000f'4240'0000'0064ull; //100 + (1000000 << 32)
+			constexpr std::uint64_t mul2 = 0x0000'2710'0000'0001ull; //1 + (10000 << 32)
+			chunk -= 0x3030'3030'3030'3030ull;
+			chunk = (chunk * 10) + (chunk >> 8);
+			chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+			return static_cast<std::uint32_t>(chunk);
+		}
+
+		constexpr const char* skip_decimal_digits(const char* first, const char* last) noexcept
+		{
+			while (last - first >= 8 && is_eight_decimal_digits(load_u64_little_endian(first)))
+			{
+				first += 8;
+			}
+			while (first != last && digit_value(*first) < 10)
+			{
+				++first;
+			}
+			return first;
+		}
+
+		constexpr std::uint64_t parse_decimal_chunk(const char*& first, const char* last, std::ptrdiff_t max_digits) noexcept
+		{
+			const char* const begin = first;
+			std::uint64_t ret = 0;
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+			if (!std::is_constant_evaluated() && max_digits >= 16 && last - first >= 16
+				&& can_use_ssse3() && try_parse_sixteen_decimal_digits_ssse3(first, ret))
+			{
+				first += 16;
+			}
+#endif
+			while (max_digits - (first - begin) >= 8 && last - first >= 8)
+			{
+				const std::uint64_t chunk = load_u64_little_endian(first);
+				if (!is_eight_decimal_digits(chunk))
+					break;
+				ret = ret * 100'000'000u + parse_eight_decimal_digits(chunk);
+				first += 8;
+			}
+			while (first - begin < max_digits && first != last)
+			{
+				const unsigned digit = digit_value(*first);
+				if (digit >= 10)
+					break;
+				ret = ret * 10 + digit;
+				++first;
+			}
+			return ret;
+		}
+
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+		CJM_TARGET_SSSE3 inline bool try_parse_sixteen_decimal_digits_ssse3(const char* first, std::uint64_t& value) noexcept
+		{
+			const __m128i digits = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), _mm_set1_epi8('0'));
+			const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+			if (_mm_movemask_epi8(is_digit) != 0xffff)
+			{
+				return false;
+			}
+			//pairs, then groups of four (at most 9999, so they survive the signed pack), then groups of eight
+			const __m128i pairs = _mm_maddubs_epi16(digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+			const __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+			const __m128i packed = _mm_packs_epi32(quads, quads);
+			const __m128i octets = _mm_madd_epi16(packed, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+			const auto high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(octets));
+			const auto low = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(octets, 4)));
+			value = static_cast<std::uint64_t>(high) * 100'000'000u + low;
+			return true;
+		}
+#endif
+
+		constexpr std::array<radix_chunk, 37> radix_chunks = []() -> std::array<radix_chunk, 37>
+		{
+			std::array<radix_chunk, 37> ret{};
+			for (std::uint64_t base = 2; base < ret.size(); ++base)
+			{
+				radix_chunk chunk{ 1, 0, 0, 0 };
+				for (; chunk.divisor <= std::numeric_limits<std::uint64_t>::max() / base; chunk.divisor *= base)
+				{
+					++chunk.digits;
+				}
+				chunk.shift = std::countl_zero(chunk.divisor);
+				chunk.reciprocal = reciprocal_2by1(chunk.divisor << chunk.shift);
+				ret[base] = chunk;
+			}
+			return ret;
+		}();
+
+		constexpr int radix_shift(int base) noexcept
+		{
+			const auto radix = static_cast<unsigned>(base);
+			return std::has_single_bit(radix) ? std::countr_zero(radix) : 0;
+		}
+
+		constexpr unsigned digit_value(char c) noexcept
+		{
+			if (c >= '0' && c <= '9')
+				return static_cast<unsigned>(c - '0');
+			if (c >= 'a' && c <= 'z')
+				return static_cast<unsigned>(c - 'a') + 10u;
+			if (c >= 'A' && c <= 'Z')
+				return static_cast<unsigned>(c - 'A') + 10u;
+			return std::numeric_limits<unsigned>::max();
+		}
+
+		constexpr char* write_u64_digits_backward(char* end, std::uint64_t value,
+			std::uint64_t base, int min_digits) noexcept
+		{
+			int written = 0;
+			//once the value fits in 32 bits, 32-bit division is considerably cheaper
+			for (; value > std::numeric_limits<std::uint32_t>::max(); ++written)
+			{
+				*--end = u128_digit_chars[static_cast<size_t>(value % base)];
+				value /= base;
+			}
+			const auto radix = static_cast<std::uint32_t>(base);
+			auto small_value = static_cast<std::uint32_t>(value);
+			do
+			{
+				*--end = u128_digit_chars[small_value % radix];
+				small_value /= radix;
+				++written;
+			} while (small_value != 0);
+			for (; written < min_digits; ++written)
+			{
+				*--end = '0';
+			}
+			return end;
+		}
+
+		constexpr char* write_u128_pow2_digits_backward(char* end, uint128 value, int shift) noexcept
+		{
+			const std::uint64_t mask = (std::uint64_t{ 1 } << shift) - 1;
+			while (value.high_part() != 0)
+			{
+				*--end = u128_digit_chars[static_cast<size_t>(value.low_part() & mask)];
+				value >>= shift;
+			}
+			std::uint64_t low = value.low_part();
+			do
+			{
+				*--end = u128_digit_chars[static_cast<size_t>(low & mask)];
+				low >>= shift;
+			} while (low != 0);
+			return end;
+		}
+
+		constexpr char* write_u128_digits_backward(char* end, uint128 value, int base) noexcept
+		{
+			if (base == 10)
+			{
+				return write_u128_decimal_backward(end, value);
+			}
+			if (base == 16)
+			{
+				return write_u128_hex_backward(end, value, false);
+			}
+			if (const int shift = radix_shift(base); shift != 0)
+			{
+				return write_u128_pow2_digits_backward(end, value, shift);
+			}
+			const radix_chunk& chunk = radix_chunks[static_cast<size_t>(base)];
+			const auto radix = static_cast<std::uint64_t>(base);
+			//peel off full-width chunks until what remains fits in a single limb
+			while (value.high_part() != 0)
+			{
+				const auto [quotient, remainder] = div_mod_normalized_u64(value, chunk.divisor << chunk.shift,
+					chunk.reciprocal, chunk.shift);
+				end = write_u64_digits_backward(end, remainder.low_part(), radix, chunk.digits);
+				value = quotient;
+			}
+			return write_u64_digits_backward(end, value.low_part(), radix, 1);
+		}
+
+		constexpr bool multiply_add_u64(uint128& value, std::uint64_t multiplier, std::uint64_t addend) noexcept
+		{
+			const uint128 low = full_multiply_u64(value.low_part(), multiplier);
+			const uint128 high = full_multiply_u64(value.high_part(), multiplier);
+			const std::uint64_t product_high = high.low_part() + low.high_part();
+			if (high.high_part() != 0 || product_high < low.high_part())
+			{
+				return false;
+			}
+			const uint128 product = uint128::make_uint128(product_high, low.low_part());
+			value = product + addend;
+			return value >= product;
+		}
+
+		constexpr std::from_chars_result parse_u128_pow2_digits(const char* first, const char* last,
+			uint128& value, int shift) noexcept
+		{
+			const unsigned radix = 1u << shift;
+			const char* pos = first;
+			while (pos != last && *pos == '0')
+			{
+				++pos;
+			}
+			const char* const significant = pos;
+			uint128 result = 0;
+			for (unsigned digit; pos != last && (digit = digit_value(*pos)) < radix; ++pos)
+			{
+				result = (result << shift) | digit;
+			}
+			if (pos == first)
+			{
+				return std::from_chars_result{ first, std::errc::invalid_argument };
+			}
+			//every digit but the first carries exactly shift bits: overflow is a matter of counting them
+			if (pos != significant)
+			{
+				const auto bits = (pos - significant - 1) * shift + std::bit_width(digit_value(*significant));
+				if (bits > std::numeric_limits<uint128>::digits)
+				{
+					return std::from_chars_result{ pos, std::errc::result_out_of_range };
+				}
+			}
+			value = result;
+			return std::from_chars_result{ pos, std::errc{} };
+		}
+
+		constexpr std::from_chars_result parse_u128_chunked_digits(const char* first, const char* last,
+			uint128& value, int base) noexcept
+		{
+			const auto radix = static_cast<unsigned>(base);
+			const radix_chunk& chunk = radix_chunks[static_cast<size_t>(base)];
+			uint128 result = 0;
+			bool overflowed = false;
+			const char* pos = first;
+			//digits are gathered a limb's worth at a time: one 128-bit multiply-add per chunk rather than per digit
+			while (pos != last)
+			{
+				const char* const chunk_end = last - pos > chunk.digits ? pos + chunk.digits : last;
+				const char* const chunk_begin = pos;
+				std::uint64_t digits = 0;
+				std::uint64_t scale = 1;
+				for (unsigned digit; pos != chunk_end && (digit = digit_value(*pos)) < radix; ++pos)
+				{
+					digits = digits * radix + digit;
+					scale *= radix;
+				}
+				if (pos == chunk_begin)
+				{
+					break;
+				}
+				overflowed = !multiply_add_u64(result, scale, digits) || overflowed;
+				if (pos != chunk_end)
+				{
+					break;
+				}
+			}
+			if (pos == first)
+			{
+				return std::from_chars_result{ first, std::errc::invalid_argument };
+			}
+			if (overflowed)
+			{
+				return std::from_chars_result{ pos, std::errc::result_out_of_range };
+			}
+			value = result;
+			return std::from_chars_result{ pos, std::errc{} };
+		}
+	}
+
+	constexpr u128_u64_divmod_result div_mod_u64(uint128 dividend, std::uint64_t divisor)
+	{
+		if (divisor == 0)
+		{
+			throw std::domain_error("Division and/or modulus by zero is forbidden.");
+		}
+		return unsafe_div_mod_u64(dividend, divisor);
+	}
+
+	constexpr u128_u64_divmod_result unsafe_div_mod_u64(uint128 dividend, std::uint64_t divisor) noexcept
+	{
+		assert(divisor != 0);
+#if defined(CJM_UDIV_INTRINSIC_AVAILABLE) || defined(CJM_GNU_X64_ASM_DIVQ_AVAILABLE)
+		if (!std::is_constant_evaluated())
+		{
+			//the instruction faults unless the quotient fits in 64 bits: first divide the high limb on its own if needed
+			std::uint64_t high_quotient = 0;
+			std::uint64_t high = dividend.high_part();
+			if (high >= divisor)
+			{
+				high_quotient = high / divisor;
+				high %= divisor;
+			}
+#ifdef CJM_UDIV_INTRINSIC_AVAILABLE
+			std::uint64_t remainder = 0;
+			const std::uint64_t low_quotient = CJM_UDIV128(high, dividend.low_part(), divisor, &remainder);
+#else
+			const auto [low_quotient, remainder] = internal::div_mod_2by1_divq(high, dividend.low_part(), divisor);
+#endif
+			return u128_u64_divmod_result{ uint128::make_uint128(high_quotient, low_quotient), remainder };
+		}
+#endif
+		const int shift = std::countl_zero(divisor);
+		const std::uint64_t normalized_divisor = divisor << shift;
+		const auto [quotient, remainder] = internal::div_mod_normalized_u64(dividend, normalized_divisor,
+			internal::reciprocal_2by1(normalized_divisor), shift);
+		return u128_u64_divmod_result{ quotient, remainder.low_part() };
+	}
+
+	constexpr u128_wide_product wide_multiply(uint128 multiplicand, uint128 multiplier) noexcept
+	{
+		const uint128 low_low = internal::full_multiply_u64(multiplicand.low_part(), multiplier.low_part());
+		const uint128 low_high = internal::full_multiply_u64(multiplicand.low_part(), multiplier.high_part());
+		const uint128 high_low = internal::full_multiply_u64(multiplicand.high_part(), multiplier.low_part());
+		const uint128 high_high = internal::full_multiply_u64(multiplicand.high_part(), multiplier.high_part());
+		const auto [cross, cross_carry] = add_with_carry(low_high, high_low, 0);
+		const auto [low, low_carry] = add_with_carry(low_low, uint128::make_uint128(cross.low_part(), 0), 0);
+		//the product is less than 2^256: no carry out of the high half
+		const uint128 high = high_high + uint128::make_uint128(cross_carry, cross.high_part()) + low_carry;
+		return u128_wide_product{ high, low };
+	}
+
+	constexpr uint128 mulhi(uint128 multiplicand, uint128 multiplier) noexcept
+	{
+		const uint128 low_low = internal::full_multiply_u64(multiplicand.low_part(), multiplier.low_part());
+		const uint128 low_high = internal::full_multiply_u64(multiplicand.low_part(), multiplier.high_part());
+		const uint128 high_low = internal::full_multiply_u64(multiplicand.high_part(), multiplier.low_part());
+		const uint128 high_high = internal::full_multiply_u64(multiplicand.high_part(), multiplier.high_part());
+		//at most 3 * (2^64 - 1): the carry into the high half fits in its high limb
+		const uint128 middle = uint128{ low_low.high_part() } + low_high.low_part() + high_low.low_part();
+		return high_high + low_high.high_part() + high_low.high_part() + middle.high_part();
+	}
+
+	constexpr int popcount(uint128 value) noexcept
+	{
+		return internal::popcount_u64(value.low_part()) + internal::popcount_u64(value.high_part());
+	}
+
+	constexpr int countl_zero(uint128 value) noexcept
+	{
+		const int high_zeroes = internal::countl_zero_u64(value.high_part());
+		return high_zeroes == std::numeric_limits<std::uint64_t>::digits
+			? high_zeroes + internal::countl_zero_u64(value.low_part())
+			: high_zeroes;
+	}
+
+	constexpr int countr_zero(uint128 value) noexcept
+	{
+		const int low_zeroes = internal::countr_zero_u64(value.low_part());
+		return low_zeroes == std::numeric_limits<std::uint64_t>::digits
+			? low_zeroes + internal::countr_zero_u64(value.high_part())
+			: low_zeroes;
+	}
+
+	constexpr int countl_one(uint128 value) noexcept
+	{
+		return countl_zero(~value);
+	}
+
+	constexpr int countr_one(uint128 value) noexcept
+	{
+		return countr_zero(~value);
+	}
+
+	constexpr int bit_width(uint128 value) noexcept
+	{
+		return std::numeric_limits<uint128>::digits - countl_zero(value);
+	}
+
+	constexpr bool has_single_bit(uint128 value) noexcept
+	{
+		return value != 0 && (value & (value - 1)) == 0;
+	}
+
+	constexpr uint128 bit_floor(uint128 value) noexcept
+	{
+		return value == 0 ? uint128{ 0 } : uint128{ 1 } << (bit_width(value) - 1);
+	}
+
+	constexpr uint128 bit_ceil(uint128 value) noexcept
+	{
+		assert(value <= (uint128{ 1 } << (std::numeric_limits<uint128>::digits - 1)));
+		return value <= 1 ? uint128{ 1 } : uint128{ 1 } << bit_width(value - 1);
+	}
+
+	constexpr uint128 rotl(uint128 value, int count) noexcept
+	{
+		constexpr int digits = std::numeric_limits<uint128>::digits;
+		const int shift = count % digits;
+		if (shift == 0)
+		{
+			return value;
+		}
+		if (shift < 0)
+		{
+			return rotr(value, -shift);
+		}
+		return (value << shift) | (value >> (digits - shift));
+	}
+
+	constexpr uint128 rotr(uint128 value, int count) noexcept
+	{
+		constexpr int digits = std::numeric_limits<uint128>::digits;
+		const int shift = count % digits;
+		if (shift == 0)
+		{
+			return value;
+		}
+		if (shift < 0)
+		{
+			return rotl(value, -shift);
+		}
+		return (value >> shift) | (value << (digits - shift));
+	}
+
+	constexpr uint128 byteswap(uint128 value) noexcept
+	{
+		return uint128::make_uint128(internal::byteswap_u64(value.low_part()), internal::byteswap_u64(value.high_part()));
+	}
+
+	constexpr int decimal_digit_count(uint128 value) noexcept
+	{
+		if (value.high_part() == 0)
+		{
+			return internal::count_decimal_digits(value.low_part());
+		}
+		//log10(2) ~= 1233 / 4096: guess is either the digit count or one less
+		const int guess = ((std::numeric_limits<uint128>::digits - countl_zero(value)) * 1233) >> 12;
+		return guess + (value >= internal::u128_powers_of_ten[static_cast<size_t>(guess)] ? 1 : 0);
+	}
+
+	constexpr char* write_decimal_unchecked(char* first, uint128 value) noexcept
+	{
+		char* const last = first + decimal_digit_count(value);
+		internal::write_u128_decimal_backward(last, value);
+		return last;
+	}
+
+	constexpr char* write_hex_fixed_unchecked(char* first, uint128 value, bool upper_case) noexcept
+	{
+		if (std::is_constant_evaluated())
+		{
+			return internal::write_hex_fixed_scalar(first, value, upper_case);
+		}
+		else
+		{
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+			if (internal::can_use_ssse3())
+			{
+				internal::hex_encode_fixed_ssse3(first, value, upper_case);
+				return first + internal::u128_hex_digits;
+			}
+#endif
+			return internal::write_hex_fixed_scalar(first, value, upper_case);
+		}
+	}
+
+	constexpr char* write_hex_unchecked(char* first, uint128 value, bool upper_case) noexcept
+	{
+		std::array<char, internal::u128_hex_digits> fixed{};
+		write_hex_fixed_unchecked(fixed.data(), value, upper_case);
+		return std::copy(fixed.cend() - internal::hex_digit_count(value), fixed.cend(), first);
+	}
+
+	constexpr std::from_chars_result from_hex_chars(const char* first, const char* last, uint128& value) noexcept
+	{
+		constexpr auto max_digits = static_cast<std::ptrdiff_t>(internal::u128_hex_digits);
+		const std::ptrdiff_t length = last - first;
+		uint128 result = 0;
+		std::uint32_t valid_mask;
+		if (length >= max_digits)
+		{
+			valid_mask = internal::hex_decode_fixed(first, result);
+			if (valid_mask == std::numeric_limits<std::uint32_t>::max())
+			{
+				if (length == max_digits
+					|| internal::hex_nibble_values[static_cast<unsigned char>(first[max_digits])] == internal::invalid_hex_nibble)
+				{
+					value = result;
+					return std::from_chars_result{ first + max_digits, std::errc{} };
+				}
+				//more than 32 digits: still in range if the excess are leading zeros
+				return internal::parse_u128_pow2_digits(first, last, value, 4);
+			}
+		}
+		else
+		{
+			std::array<char, internal::u128_hex_digits> window{};
+			std::copy(first, last, window.begin());
+			valid_mask = internal::hex_decode_fixed(window.data(), result);
+		}
+		//fewer than 32 digits: right-align them behind leading zeros and convert again
+		const auto digits = static_cast<std::ptrdiff_t>(std::countr_one(valid_mask));
+		if (digits == 0)
+		{
+			return std::from_chars_result{ first, std::errc::invalid_argument };
+		}
+		std::array<char, internal::u128_hex_digits> padded{};
+		std::fill(padded.begin(), padded.end() - digits, '0');
+		std::copy(first, first + digits, padded.end() - digits);
+		internal::hex_decode_fixed(padded.data(), result);
+		value = result;
+		return std::from_chars_result{ first + digits, std::errc{} };
+	}
+
+	constexpr std::from_chars_result from_decimal_chars(const char* first, const char* last, uint128& value) noexcept
+	{
+		constexpr auto max_limb_digits = static_cast<std::ptrdiff_t>(std::numeric_limits<std::uint64_t>::digits10);
+		//a 39 digit value fits if its first 38 digits are at most limit and, when equal, its last digit at most limit_digit
+		constexpr auto limit = std::numeric_limits<uint128>::max() / 10;
+		constexpr auto limit_digit = static_cast<unsigned>(std::numeric_limits<uint128>::max() % 10);
+		const char* pos = first;
+		while (pos != last && *pos == '0')
+		{
+			++pos;
+		}
+		const bool leading_zeros = pos != first;
+		const char* const significant = pos;
+		const std::uint64_t high = internal::parse_decimal_chunk(pos, last, max_limb_digits);
+		if (pos == significant)
+		{
+			if (!leading_zeros)
+			{
+				return std::from_chars_result{ first, std::errc::invalid_argument };
+			}
+			value = 0;
+			return std::from_chars_result{ pos, std::errc{} };
+		}
+		uint128 result = high;
+		if (pos - significant == max_limb_digits)
+		{
+			const char* const low_begin = pos;
+			const std::uint64_t low = internal::parse_decimal_chunk(pos, last, max_limb_digits);
+			//at most 38 digits: cannot overflow
+			result = internal::full_multiply_u64(high, internal::u64_powers_of_ten[static_cast<size_t>(pos - low_begin)]) + low;
+			if (pos - low_begin == max_limb_digits && pos != last && internal::digit_value(*pos) < 10)
+			{
+				const unsigned final_digit = internal::digit_value(*pos++);
+				const char* const end = internal::skip_decimal_digits(pos, last);
+				if (end != pos || result > limit || (result == limit && final_digit > limit_digit))
+				{
+					return std::from_chars_result{ end, std::errc::result_out_of_range };
+				}
+				result = result * 10 + final_digit;
+			}
+		}
+		value = result;
+		return std::from_chars_result{ pos, std::errc{} };
+	}
+
+	namespace internal
+	{
+		constexpr u128_parse_result parse_u128_text(std::string_view text) noexcept
+		{
+			if (text.empty())
+			{
+				return u128_parse_result{ std::nullopt, u128_parse_error::Empty };
+			}
+			if (text.find_first_not_of('0') == std::string_view::npos)
+			{
+				return u128_parse_result{ uint128{}, u128_parse_error::None };
+			}
+			uint128 value = 0;
+			if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+			{
+				const std::string_view digits = text.substr(2);
+				if (digits.size() > u128_hex_digits)
+				{
+					return u128_parse_result{ std::nullopt, u128_parse_error::Illegal };
+				}
+				const auto [ptr, ec] = from_hex_chars(digits.data(), digits.data() + digits.size(), value);
+				return ec == std::errc{} && ptr == digits.data() + digits.size()
+					? u128_parse_result{ value, u128_parse_error::None }
+					: u128_parse_result{ std::nullopt, u128_parse_error::Illegal };
+			}
+			if (text[0] == '0')
+			{
+				//redundant leading zeros are not accepted for decimal text
+				return u128_parse_result{ std::nullopt, u128_parse_error::Illegal };
+			}
+			const auto [ptr, ec] = from_decimal_chars(text.data(), text.data() + text.size(), value);
+			if (ptr != text.data() + text.size())
+			{
+				return u128_parse_result{ std::nullopt, u128_parse_error::Illegal };
+			}
+			return ec == std::errc{}
+				? u128_parse_result{ value, u128_parse_error::None }
+				: u128_parse_result{ std::nullopt, u128_parse_error::Overflow };
+		}
+
+		template<typename Char>
+		constexpr const Char* parse_u128_format_spec(const Char* first, const Char* last,
+			u128_format_spec<Char>& spec) noexcept
+		{
+			constexpr size_t max_number = static_cast<size_t>(std::numeric_limits<int>::max());
+			auto is_align = [](Char c) -> bool
+			{
+				return c == '<' || c == '>' || c == '^';
+			};
+			auto is_digit = [](Char c) -> bool
+			{
+				return c >= '0' && c <= '9';
+			};
+			auto parse_number = [=](const Char*& pos, size_t& number) -> bool
+			{
+				const Char* const begin = pos;
+				number = 0;
+				for (; pos != last && is_digit(*pos); ++pos)
+				{
+					number = number * 10 + static_cast<size_t>(*pos - '0');
+					if (number > max_number)
+						return false;
+				}
+				return pos != begin;
+			};
+
+			const Char* pos = first;
+			if (pos == last || *pos == '}')
+			{
+				return pos;
+			}
+			if (last - pos >= 2 && is_align(pos[1]) && pos[0] != '{' && pos[0] != '}')
+			{
+				spec.fill = pos[0];
+				spec.align = static_cast<char>(pos[1]);
+				pos += 2;
+			}
+			else if (is_align(*pos))
+			{
+				spec.align = static_cast<char>(*pos++);
+			}
+			if (pos != last && (*pos == '+' || *pos == '-' || *pos == ' '))
+			{
+				spec.sign = static_cast<char>(*pos++);
+			}
+			if (pos != last && *pos == '#')
+			{
+				spec.alternate_form = true;
+				++pos;
+			}
+			if (pos != last && *pos == '0')
+			{
+				spec.zero_pad = true;
+				++pos;
+			}
+			if (pos != last && *pos == '{')
+			{
+				spec.width_from_arg = true;
+				++pos;
+				if (pos != last && *pos != '}')
+				{
+					size_t arg_id = 0;
+					if (!parse_number(pos, arg_id))
+						return nullptr;
+					spec.width_arg_id = arg_id;
+				}
+				if (pos == last || *pos != '}')
+					return nullptr;
+				++pos;
+			}
+			else if (pos != last && is_digit(*pos) && !parse_number(pos, spec.width))
+			{
+				return nullptr;
+			}
+			if (pos != last && *pos != '}')
+			{
+				switch (*pos)
+				{
+				case 'b':
+				case 'B':
+				case 'o':
+				case 'd':
+				case 'x':
+				case 'X':
+					spec.type = static_cast<char>(*pos++);
+					break;
+				default:
+					//precision and locale-specific formatting are not supported for integers
+					return nullptr;
+				}
+			}
+			return pos == last || *pos == '}' ? pos : nullptr;
+		}
+
+		template<typename Char, std::output_iterator<const Char&> OutputIt>
+		constexpr OutputIt write_u128_formatted(OutputIt out, uint128 value,
+			const u128_format_spec<Char>& spec, size_t width, bool negative)
+		{
+			//room for a sign and a two character base prefix
+			std::array<char, u128_max_chars + 3> buffer{};
+			char* pos = buffer.data();
+			if (negative)
+			{
+				*pos++ = '-';
+			}
+			else if (spec.sign == '+' || spec.sign == ' ')
+			{
+				*pos++ = spec.sign;
+			}
+			int base = 10;
+			switch (spec.type)
+			{
+			case 'b':
+			case 'B':
+				base = 2;
+				break;
+			case 'o':
+				base = 8;
+				break;
+			case 'x':
+			case 'X':
+				base = 16;
+				break;
+			default:
+				break;
+			}
+			if (spec.alternate_form)
+			{
+				if (base == 2 || base == 16)
+				{
+					*pos++ = '0';
+					*pos++ = spec.type;
+				}
+				else if (base == 8 && value != 0)
+				{
+					*pos++ = '0';
+				}
+			}
+			char* const digits = pos;
+			char* const end = base == 16
+				? write_hex_unchecked(digits, value, spec.type == 'X')
+				: to_chars(digits, buffer.data() + buffer.size(), value, base).ptr;
+			const auto length = static_cast<size_t>(end - buffer.data());
+			const size_t padding = width > length ? width - length : 0;
+			if (spec.zero_pad && spec.align == '\0')
+			{
+				//zeros go between the sign and prefix and the digits
+				out = std::copy(buffer.data(), digits, out);
+				out = std::fill_n(out, padding, static_cast<Char>('0'));
+				return std::copy(digits, end, out);
+			}
+			const size_t before = spec.align == '<' ? 0 : (spec.align == '^' ? padding / 2 : padding);
+			out = std::fill_n(out, before, spec.fill);
+			out = std::copy(buffer.data(), end, out);
+			return std::fill_n(out, padding - before, spec.fill);
+		}
+
+#ifdef __cpp_lib_format
+		template<typename Char>
+		constexpr typename std::basic_format_parse_context<Char>::iterator parse_u128_format_context(
+			std::basic_format_parse_context<Char>& ctx, u128_format_spec<Char>& spec)
+		{
+			const Char* const first = std::to_address(ctx.begin());
+			const Char* const end = parse_u128_format_spec(first, first + (ctx.end() - ctx.begin()), spec);
+			if (end == nullptr)
+			{
+				throw std::format_error{ "Invalid format specification for uint128." };
+			}
+			if (spec.width_from_arg)
+			{
+				if (spec.width_arg_id.has_value())
+					ctx.check_arg_id(*spec.width_arg_id);
+				else
+					spec.width_arg_id = ctx.next_arg_id();
+			}
+			return ctx.begin() + (end - first);
+		}
+
+		template<typename Char, typename FormatContext>
+		size_t resolve_u128_format_width(const u128_format_spec<Char>& spec, FormatContext& ctx)
+		{
+			if (!spec.width_from_arg)
+			{
+				return spec.width;
+			}
+			return std::visit_format_arg([](auto arg) -> size_t
+			{
+				using arg_t = decltype(arg);
+				if constexpr (std::is_integral_v<arg_t> && !std::is_same_v<arg_t, bool> && !std::is_same_v<arg_t, Char>)
+				{
+					if constexpr (std::is_signed_v<arg_t>)
+					{
+						if (arg < 0)
+							throw std::format_error{ "Width argument for uint128 must be non-negative." };
+					}
+					return static_cast<size_t>(arg);
+				}
+				else
+				{
+					throw std::format_error{ "Width argument for uint128 must be an integer." };
+				}
+			}, ctx.arg(*spec.width_arg_id));
+		}
+#endif
+
+		template<typename Char>
+		constexpr Char* write_decimal_sequence(Char* out, std::span<const uint128> values,
+			std::span<const Char> separator, bool leading_separator) noexcept
+		{
+			for (const uint128 value : values)
+			{
+				if (leading_separator)
+				{
+					out = std::copy(separator.begin(), separator.end(), out);
+				}
+				leading_separator = true;
+				if constexpr (std::is_same_v<Char, char>)
+				{
+					out = write_decimal_unchecked(out, value);
+				}
+				else
+				{
+					std::array<char, std::numeric_limits<uint128>::digits10 + 1> buffer{};
+					char* const end = write_decimal_unchecked(buffer.data(), value);
+					out = std::copy(buffer.data(), end, out);
+				}
+			}
+			return out;
+		}
+
+		constexpr size_t slice_plan::offset(size_t slice) const noexcept
+		{
+			return std::min(slice * slice_size, count);
+		}
+
+		constexpr size_t slice_plan::length(size_t slice) const noexcept
+		{
+			return std::min(slice_size, count - offset(slice));
+		}
+
+		constexpr slice_plan make_slice_plan(size_t count, unsigned max_threads) noexcept
+		{
+			const size_t slices = std::max<size_t>(1, std::min<size_t>(max_threads, count / slice_plan::min_values_per_slice));
+			return slice_plan{ count, slices, (count + slices - 1) / slices };
+		}
+
+		template<typename SliceFunc>
+			requires std::is_nothrow_invocable_v<SliceFunc&, size_t>
+		void for_each_slice(const slice_plan& plan, SliceFunc slice_func)
+		{
+			size_t next = 1;
+			std::vector<std::jthread> workers;
+			try
+			{
+				workers.reserve(plan.slices - 1);
+				for (; next < plan.slices; ++next)
+				{
+					workers.emplace_back(std::ref(slice_func), next);
+				}
+			}
+			catch (...)
+			{
+				//out of threads or memory: whatever did not get a thread runs here
+			}
+			slice_func(size_t{ 0 });
+			for (; next < plan.slices; ++next)
+			{
+				slice_func(next);
+			}
+		}
+	}
+
+	constexpr void hash_batch(std::span<const uint128> values, std::span<size_t> hashes) noexcept
+	{
+		assert(hashes.size() == values.size());
+		//the hashes are independent, so the multiplies of consecutive iterations overlap in the pipeline
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			hashes[i] = values[i].hash_code();
+		}
+	}
+
+	constexpr size_t legacy_uint128_hash::operator()(const uint128& key_val) const noexcept
+	{
+		return key_val.legacy_hash_code();
+	}
+
+	constexpr size_t formatted_decimal_length(std::span<const uint128> values, size_t separator_length) noexcept
+	{
+		size_t ret = values.empty() ? 0 : (values.size() - 1) * separator_length;
+		for (const uint128 value : values)
+		{
+			ret += static_cast<size_t>(decimal_digit_count(value));
+		}
+		return ret;
+	}
+
+	constexpr std::to_chars_result format_decimal(std::span<const uint128> values, char* first, char* last,
+		std::string_view separator) noexcept
+	{
+		if (formatted_decimal_length(values, separator.size()) > static_cast<size_t>(last - first))
+		{
+			return std::to_chars_result{ last, std::errc::value_too_large };
+		}
+		return std::to_chars_result{ internal::write_decimal_sequence(first, values, std::span{ separator }, false), std::errc{} };
+	}
+
+	template<typename Char, typename CharTraits, typename Allocator>
+		requires cjm::numerics::concepts::char_with_traits_and_allocator<Char, CharTraits, Allocator>
+	std::basic_string<Char, CharTraits, Allocator>& format_decimal(std::span<const uint128> values,
+		std::basic_string<Char, CharTraits, Allocator>& output,
+		std::type_identity_t<std::basic_string_view<Char, CharTraits>> separator, unsigned max_threads)
+	{
+		const auto separator_span = std::span<const Char>{ separator.data(), separator.size() };
+		const auto plan = internal::make_slice_plan(values.size(), max_threads);
+
+		//exact lengths first so output grows once and each slice knows where it starts
+		std::vector<size_t> offsets(plan.slices + 1, output.size());
+		for (size_t i = 0; i < plan.slices; ++i)
+		{
+			const auto slice = values.subspan(plan.offset(i), plan.length(i));
+			offsets[i + 1] = offsets[i] + formatted_decimal_length(slice, separator.size()) + (i != 0 && !slice.empty() ? separator.size() : 0);
+		}
+		output.resize(offsets[plan.slices]);
+
+		internal::for_each_slice(plan, [&](size_t i) noexcept -> void
+		{
+			internal::write_decimal_sequence(output.data() + offsets[i], values.subspan(plan.offset(i), plan.length(i)),
+				separator_span, i != 0);
+		});
+		return output;
+	}
+}
+
+namespace cjm::numerics::internal
+{
+	template<concepts::builtin_floating_point TFloat>
+	uint128 make_from_floating_point(TFloat v) noexcept
+	{
+		using flt_t = std::remove_cvref_t<TFloat>;
+		if constexpr (std::is_same_v<flt_t, long double> && !sse3_available &&
+			// ReSharper disable once CppRedundantBooleanExpressionArgument
+			(compiler == compiler_used::clang || compiler == compiler_used::clang_gcc))
+		{
+			// Go 50 bits at a time, that fits in a double
+			static_assert(std::numeric_limits<double>::digits >= 50, "double digits must >= 50");
+			static_assert(std::numeric_limits<long double>::digits <= 150, "long double digits must <= 150.");
+			// Undefined behavior if v is not finite or cannot fit into uint128.
+			assert(std::isfinite(v) && v > -1 && v < std::ldexp(1.0L, 128));
+
+			v = std::ldexp(v, -100);
+			const auto w0 = static_cast<std::uint64_t>(static_cast<double>(std::trunc(v)));
+			v = std::ldexp(v - static_cast<double>(w0), 50);
+			const auto w1 = static_cast<std::uint64_t>(static_cast<double>(std::trunc(v)));
+			v = std::ldexp(v - static_cast<double>(w1), 50);
+			const auto w2 = static_cast<std::uint64_t>(static_cast<double>(std::trunc(v)));
+			return (static_cast<uint128>(w0) << 100) | (static_cast<uint128>(w1) << 50) |
+				static_cast<uint128>(w2);
+		}
+		else
+		{
+
 			// Rounding behavior is towards zero, same as for built-in types.
 			// Undefined behavior if v is NaN or cannot fit into uint128.
 			assert(std::isfinite(v) && v > -1 &&
@@ -2501,11 +4103,9 @@ namespace cjm::numerics::internal
 	Ui128 add_with_carry(Ui128 first_addend, Ui128 second_addend, unsigned char carry_in,
 		unsigned char& carry_out) noexcept
 	{
-		Ui128 ret = first_addend;
-		if (carry_in)
-			++ret;
-		ret += second_addend;
-		carry_out = ret < first_addend ? 1 : 0;
+		const Ui128 sum = first_addend + second_addend;
+		const Ui128 ret = sum + (carry_in ? 1 : 0);
+		carry_out = (sum < first_addend || ret < sum) ? 1 : 0;
 		return ret;
 	}
 
@@ -2513,12 +4113,10 @@ namespace cjm::numerics::internal
 	Ui128 sub_with_borrow(Ui128 minuend, Ui128 subtrahend, unsigned char borrow_in,
 		unsigned char& borrow_out) noexcept
 	{
-		Ui128 ret = minuend;
-		if (borrow_in)
-			--ret;
-		ret -= subtrahend;
-		borrow_out = ret > minuend ? 1 : 0;
-		return ret;
+		const Ui128 difference = minuend - subtrahend;
+		const Ui128 borrow = borrow_in ? 1 : 0;
+		borrow_out = (minuend < subtrahend || difference < borrow) ? 1 : 0;
+		return difference - borrow;
 	}
 
 	template<concepts::cjm_unsigned_integer Ui128>
@@ -2526,11 +4124,9 @@ namespace cjm::numerics::internal
 		Ui128 add_with_carry(Ui128 first_addend, Ui128 second_addend,
 			unsigned char carry_in, unsigned char& carry_out) noexcept
 	{
-		Ui128 ret = first_addend;
-		if (carry_in)
-			++ret;
-		ret += second_addend;
-		carry_out = ret < first_addend ? 1 : 0;
+		const Ui128 sum = first_addend + second_addend;
+		const Ui128 ret = sum + (carry_in ? 1 : 0);
+		carry_out = (sum < first_addend || ret < sum) ? 1 : 0;
 		return ret;
 	}
 
@@ -2539,12 +4135,10 @@ namespace cjm::numerics::internal
 		Ui128 sub_with_borrow(Ui128 minuend, Ui128 subtrahend,
 			unsigned char borrow_in, unsigned char& borrow_out) noexcept
 	{
-		Ui128 ret = minuend;
-		if (borrow_in)
-			--ret;
-		ret -= subtrahend;
-		borrow_out = ret > minuend ? 1 : 0;
-		return ret;
+		const Ui128 difference = minuend - subtrahend;
+		const Ui128 borrow = borrow_in ? 1 : 0;
+		borrow_out = (minuend < subtrahend || difference < borrow) ? 1 : 0;
+		return difference - borrow;
 	}
 
 }
@@ -2749,16 +4343,15 @@ inline void cjm::numerics::uint128::best_safe_div_mod(uint128 dividend, uint128
 //(though allowed in C) is undefined behavior in C++ and 2- isn't necessary
 //anyway because this function is a static member of uint128 and has
 //direct access to its m_high and m_low members anyway.
-//If the optimized path from clang cannot be taken, I revert
-//to using abseil's shift with subtract algorithm as elsewhere
-//rather than using the slow-case handler from clang.
+//If the optimized path from clang cannot be taken, I estimate the
+//single-limb quotient with one more intrinsic division by the normalized
+//divisor's top limb rather than using the slow-case handler from clang.
 #ifdef CJM_UDIV_INTRINSIC_AVAILABLE
 inline void cjm::numerics::uint128::div_mod_msc_x64_impl(uint128 dividend, uint128 divisor,
 	uint128* quotient_ret, uint128* remainder_ret) noexcept
 {
 	constexpr size_t n_utword_bits = sizeof(uint128) * CHAR_BIT;
 	assert(quotient_ret != nullptr && remainder_ret != nullptr && divisor != 0);
-	uint128 quotient = 0;
 	uint128 remainder = 0;
 	if (divisor > dividend)
 	{
@@ -2766,32 +4359,34 @@ inline void cjm::numerics::uint128::div_mod_msc_x64_impl(uint128 dividend, uint1
 		*quotient_ret = 0;
 		return;
 	}
-	// When the divisor fits in 64 bits, we can use an optimized path.
+	// When the divisor fits in 64 bits, one or two _udiv128s suffice.
 	if (divisor.m_limbs.m_high == 0)
 	{
-		remainder.m_limbs.m_high = 0;
-		if (dividend.m_limbs.m_high < divisor.m_limbs.m_low)
-		{
-			// The result fits in 64 bits.
-			quotient.m_limbs.m_low = CJM_UDIV128(dividend.m_limbs.m_high, dividend.m_limbs.m_low,
-				divisor.m_limbs.m_low, &remainder.m_limbs.m_low);
-			quotient.m_limbs.m_high = 0;
-		}
-		else
-		{
-			// First, divide with the high part to get the remainder in dividend.s.high.
-			// After that dividend.s.high < divisor.s.low.
-			quotient.m_limbs.m_high = dividend.m_limbs.m_high / divisor.m_limbs.m_low;
-			dividend.m_limbs.m_high = dividend.m_limbs.m_high % divisor.m_limbs.m_low;
-			quotient.m_limbs.m_low = CJM_UDIV128(dividend.m_limbs.m_high, dividend.m_limbs.m_low,
-				divisor.m_limbs.m_low, &remainder.m_limbs.m_low);
-		}
-		*remainder_ret = remainder;
-		*quotient_ret = quotient;
+		const auto [narrow_quotient, narrow_remainder] = unsafe_div_mod_u64(dividend, divisor.m_limbs.m_low);
+		*remainder_ret = narrow_remainder;
+		*quotient_ret = narrow_quotient;
 		return;
 	}
-	unsafe_constexpr_div_mod_impl(dividend, divisor, quotient_ret, remainder_ret);
-	return;
+	// The divisor needs both limbs: the quotient fits in one.  Estimate it from the top
+	// limb of the normalized divisor (see unsafe_constexpr_div_mod_impl): it is exact or one too large.
+	const int shift = std::countl_zero(divisor.m_limbs.m_high);
+	const std::uint64_t divisor_top = (divisor << shift).m_limbs.m_high;
+	const uint128 halved = dividend >> 1;
+	std::uint64_t estimate_remainder = 0;
+	std::uint64_t estimate = CJM_UDIV128(halved.m_limbs.m_high, halved.m_limbs.m_low, divisor_top,
+		&estimate_remainder) >> (std::numeric_limits<std::uint64_t>::digits - 1 - shift);
+	if (estimate != 0)
+	{
+		--estimate;
+	}
+	remainder = dividend - uint128{ estimate } * divisor;
+	if (remainder >= divisor)
+	{
+		++estimate;
+		remainder -= divisor;
+	}
+	*quotient_ret = estimate;
+	*remainder_ret = remainder;
 }
 #else
 inline void cjm::numerics::uint128::div_mod_msc_x64_impl([[maybe_unused]] uint128 dividend, [[maybe_unused]] uint128 divisor, uint128* quotient_ret, uint128* remainder_ret) noexcept
@@ -2993,6 +4588,8 @@ namespace cjm::numerics::uint128_literals
 		}
 		if (arr[0] == '0' && (arr[1] == 'x' || arr[1] == 'X'))
 			return lit_helper::is_legal_hex_char(arr[2]) ? lit_type::Hexadecimal : lit_type::Illegal;
+		if (arr[0] == '0' && (arr[1] == 'b' || arr[1] == 'B'))
+			return arr[2] == '0' || arr[2] == '1' ? lit_type::Binary : lit_type::Illegal;
 		if (arr[0] == '0')
 			return lit_type::Illegal;
 		return arr[0] >= 0x30 && arr[0] <= 0x39 ? lit_type::Decimal : lit_type::Illegal;
@@ -3016,6 +4613,26 @@ namespace cjm::numerics::uint128_literals
 	}
 
 
+	template<char... Chars>
+	CJM_LIT_CONST std::optional<uint128> lit_helper::parse_binary_literal()
+	{
+		//skip the 0b prefix and the separators, then let from_chars do the rest
+		constexpr auto arr = std::array<char, sizeof...(Chars)>{ Chars... };
+		std::array<char, sizeof...(Chars)> digits{};
+		size_t digit_count = 0;
+		for (size_t idx = 2; idx < arr.size(); ++idx)
+		{
+			if (arr[idx] == '\'') continue;
+			digits[digit_count++] = arr[idx];
+		}
+		uint128 ret = 0;
+		const char* const last = digits.data() + digit_count;
+		const auto [ptr, ec] = from_chars(digits.data(), last, ret, 2);
+		if (ec != std::errc{} || ptr != last)
+			return std::nullopt;
+		return ret;
+	}
+
 	template<char... Chars>
 	CJM_LIT_CONST lit_type lit_helper::get_chars() noexcept
 	{
@@ -3148,12 +4765,25 @@ namespace cjm::numerics::uint128_literals
 	CJM_LIT_CONST std::optional<Ui> lit_helper::parse_literal()
 	{
 		constexpr lit_type type = get_lit_type<Chars...>();
-		if (type != lit_type::Decimal && type != lit_type::Hexadecimal && type != lit_type::Zero)
+		if (type != lit_type::Decimal && type != lit_type::Hexadecimal && type != lit_type::Zero
+			&& type != lit_type::Binary)
 			return std::nullopt;
 		if constexpr (type == lit_type::Zero)
 		{
 			return 0;
 		}
+		else if constexpr (type == lit_type::Binary)
+		{
+			constexpr std::optional<uint128> binary = parse_binary_literal<Chars...>();
+			if constexpr (binary.has_value() && *binary <= std::numeric_limits<Ui>::max())
+			{
+				return static_cast<Ui>(*binary);
+			}
+			else
+			{
+				return std::nullopt;
+			}
+		}
 		else
 		{
 			using reverser_t = typename internal::array_retrieval_helper<Chars...>;
@@ -0,0 +1,232 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_COLUMN_HPP_
+#define CJM_UINT128_COLUMN_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <cjm/numerics/cpu_dispatch.hpp>
+#include <cassert>
+#include <compare>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace cjm::numerics
+{
+	namespace internal
+	{
+		constexpr size_t cache_line_size = 64;
+
+		/// <summary>
+		/// Allocates on cache line boundaries, so that vector loads of a column never split a line
+		/// at the start of the data.
+		/// </summary>
+		template<typename T>
+		struct cache_aligned_allocator
+		{
+			using value_type = T;
+
+			constexpr cache_aligned_allocator() noexcept = default;
+			template<typename U>
+			constexpr cache_aligned_allocator(const cache_aligned_allocator<U>&) noexcept {} //NOLINT (rebinding)
+
+			[[nodiscard]] T* allocate(size_t count);
+			void deallocate(T* ptr, size_t count) noexcept;
+
+			template<typename U>
+			friend constexpr bool operator==(const cache_aligned_allocator&, const cache_aligned_allocator<U>&) noexcept
+			{
+				return true;
+			}
+		};
+	}
+
+	/************************************************************************/
+	/* A column of uint128 values stored as a structure of arrays: every low
+	 * limb in one cache-line-aligned array and every high limb in another.
+	 * An array of uint128 interleaves the limbs, so a vector register
+	 * loaded from it holds some low and some high limbs and carries cannot
+	 * be propagated lane-wise; here a 256-bit register holds the low (or
+	 * high) limbs of four consecutive values.
+	 *
+	 * Element-wise +, -, compare, min and max run through AVX2 kernels when
+	 * the processor has AVX2 (detected at runtime, see cpu_dispatch.hpp)
+	 * and portable loops otherwise.  The bitwise operators and shifts work
+	 * on each limb array independently and are left to the compiler's
+	 * auto-vectorizer.
+	 *
+	 * Binary operations between columns require equal sizes and throw
+	 * std::invalid_argument otherwise.
+	 *																		*/
+	/************************************************************************/
+	class uint128_column final
+	{
+	public:
+		using limb_vector = std::vector<std::uint64_t, internal::cache_aligned_allocator<std::uint64_t>>;
+		using value_type = uint128;
+		using size_type = size_t;
+
+		uint128_column() noexcept = default;
+		explicit uint128_column(size_t count);
+		uint128_column(size_t count, uint128 value);
+		explicit uint128_column(std::span<const uint128> values);
+		uint128_column(std::initializer_list<uint128> values);
+		uint128_column(const uint128_column& other) = default;
+		uint128_column(uint128_column&& other) noexcept = default;
+		uint128_column& operator=(const uint128_column& other) = default;
+		uint128_column& operator=(uint128_column&& other) noexcept = default;
+		~uint128_column() = default;
+
+		[[nodiscard]] size_t size() const noexcept;
+		[[nodiscard]] bool empty() const noexcept;
+		void reserve(size_t capacity);
+		void resize(size_t count);
+		void clear() noexcept;
+		void push_back(uint128 value);
+
+		/// <summary>
+		/// Element access by value: there is no uint128 object in the column to refer to.
+		/// </summary>
+		[[nodiscard]] uint128 operator[](size_t index) const noexcept;
+		/// <exception cref="std::out_of_range">index is not less than size().</exception>
+		[[nodiscard]] uint128 at(size_t index) const;
+		void set(size_t index, uint128 value) noexcept;
+
+		[[nodiscard]] std::span<std::uint64_t> low_parts() noexcept;
+		[[nodiscard]] std::span<const std::uint64_t> low_parts() const noexcept;
+		[[nodiscard]] std::span<std::uint64_t> high_parts() noexcept;
+		[[nodiscard]] std::span<const std::uint64_t> high_parts() const noexcept;
+
+		/// <summary>
+		/// Replaces the contents with values.
+		/// </summary>
+		void assign(std::span<const uint128> values);
+		/// <summary>
+		/// Writes the column to destination, which must be exactly size() long.
+		/// </summary>
+		/// <exception cref="std::invalid_argument">destination is not size() long.</exception>
+		void copy_to(std::span<uint128> destination) const;
+		[[nodiscard]] std::vector<uint128> to_vector() const;
+
+		uint128_column& operator+=(const uint128_column& other);
+		uint128_column& operator-=(const uint128_column& other);
+		uint128_column& operator&=(const uint128_column& other);
+		uint128_column& operator|=(const uint128_column& other);
+		uint128_column& operator^=(const uint128_column& other);
+		/// <summary>
+		/// Shifts every element by the same amount; as for uint128, amount must be less than 128.
+		/// </summary>
+		uint128_column& operator<<=(int amount) noexcept;
+		uint128_column& operator>>=(int amount) noexcept;
+
+		friend uint128_column operator+(uint128_column lhs, const uint128_column& rhs) { return lhs += rhs; }
+		friend uint128_column operator-(uint128_column lhs, const uint128_column& rhs) { return lhs -= rhs; }
+		friend uint128_column operator&(uint128_column lhs, const uint128_column& rhs) { return lhs &= rhs; }
+		friend uint128_column operator|(uint128_column lhs, const uint128_column& rhs) { return lhs |= rhs; }
+		friend uint128_column operator^(uint128_column lhs, const uint128_column& rhs) { return lhs ^= rhs; }
+		friend uint128_column operator<<(uint128_column lhs, int amount) noexcept { return lhs <<= amount; }
+		friend uint128_column operator>>(uint128_column lhs, int amount) noexcept { return lhs >>= amount; }
+
+		friend bool operator==(const uint128_column& lhs, const uint128_column& rhs) noexcept = default;
+
+		/// <summary>
+		/// Element-wise three-way comparison: each entry of the mask is -1, 0 or 1 as the element of
+		/// lhs is less than, equal to or greater than the element of rhs.
+		/// </summary>
+		/// <exception cref="std::invalid_argument">the columns differ in size.</exception>
+		[[nodiscard]] static std::vector<std::int8_t> compare(const uint128_column& lhs, const uint128_column& rhs);
+		/// <summary>
+		/// Element-wise minimum and maximum.
+		/// </summary>
+		/// <exception cref="std::invalid_argument">the columns differ in size.</exception>
+		[[nodiscard]] static uint128_column min(const uint128_column& lhs, const uint128_column& rhs);
+		[[nodiscard]] static uint128_column max(const uint128_column& lhs, const uint128_column& rhs);
+
+		/// <summary>
+		/// The element-wise kernels in use: "avx2" or "portable".
+		/// </summary>
+		[[nodiscard]] static std::string_view kernel_name() noexcept;
+
+	private:
+		void throw_if_size_differs(const uint128_column& other) const;
+
+		limb_vector m_low;
+		limb_vector m_high;
+	};
+
+	namespace internal
+	{
+		/// <summary>
+		/// The element-wise column operations on (low, high) limb arrays.  Destinations may be the
+		/// same arrays as the first operand.
+		/// </summary>
+		struct uint128_column_kernels final
+		{
+			std::string_view name;
+			void (*add)(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+				const std::uint64_t* other_high, size_t count) noexcept;
+			void (*sub)(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+				const std::uint64_t* other_high, size_t count) noexcept;
+			void (*compare)(std::int8_t* result, const std::uint64_t* lhs_low, const std::uint64_t* lhs_high,
+				const std::uint64_t* rhs_low, const std::uint64_t* rhs_high, size_t count) noexcept;
+			//keeps whichever of each pair is smaller (take_max false) or larger (take_max true)
+			void (*select)(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+				const std::uint64_t* other_high, size_t count, bool take_max) noexcept;
+		};
+
+		inline void column_add_portable(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+			const std::uint64_t* other_high, size_t count) noexcept;
+		inline void column_sub_portable(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+			const std::uint64_t* other_high, size_t count) noexcept;
+		inline void column_compare_portable(std::int8_t* result, const std::uint64_t* lhs_low,
+			const std::uint64_t* lhs_high, const std::uint64_t* rhs_low, const std::uint64_t* rhs_high,
+			size_t count) noexcept;
+		inline void column_select_portable(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+			const std::uint64_t* other_high, size_t count, bool take_max) noexcept;
+
+		constexpr uint128_column_kernels portable_uint128_column_kernels{ "portable", &column_add_portable,
+			&column_sub_portable, &column_compare_portable, &column_select_portable };
+
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+		CJM_TARGET_AVX2 inline void column_add_avx2(std::uint64_t* low, std::uint64_t* high,
+			const std::uint64_t* other_low, const std::uint64_t* other_high, size_t count) noexcept;
+		CJM_TARGET_AVX2 inline void column_sub_avx2(std::uint64_t* low, std::uint64_t* high,
+			const std::uint64_t* other_low, const std::uint64_t* other_high, size_t count) noexcept;
+		CJM_TARGET_AVX2 inline void column_compare_avx2(std::int8_t* result, const std::uint64_t* lhs_low,
+			const std::uint64_t* lhs_high, const std::uint64_t* rhs_low, const std::uint64_t* rhs_high,
+			size_t count) noexcept;
+		CJM_TARGET_AVX2 inline void column_select_avx2(std::uint64_t* low, std::uint64_t* high,
+			const std::uint64_t* other_low, const std::uint64_t* other_high, size_t count, bool take_max) noexcept;
+
+		constexpr uint128_column_kernels avx2_uint128_column_kernels{ "avx2", &column_add_avx2,
+			&column_sub_avx2, &column_compare_avx2, &column_select_avx2 };
+#endif
+
+		/// <summary>
+		/// The kernels uint128_column uses: chosen on the first call.
+		/// </summary>
+		inline const uint128_column_kernels& selected_uint128_column_kernels() noexcept;
+	}
+}
+#include <cjm/numerics/uint128_column.inl>
+#endif
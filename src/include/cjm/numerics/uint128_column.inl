@@ -0,0 +1,475 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_COLUMN_INL_
+#define CJM_UINT128_COLUMN_INL_
+#include <cjm/numerics/uint128_column.hpp>
+
+namespace cjm::numerics
+{
+	namespace internal
+	{
+		template<typename T>
+		T* cache_aligned_allocator<T>::allocate(size_t count)
+		{
+			if (count > std::numeric_limits<size_t>::max() / sizeof(T))
+			{
+				throw std::bad_array_new_length{};
+			}
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ cache_line_size }));
+		}
+
+		template<typename T>
+		void cache_aligned_allocator<T>::deallocate(T* ptr, size_t count) noexcept
+		{
+			::operator delete(ptr, count * sizeof(T), std::align_val_t{ cache_line_size });
+		}
+	}
+
+	inline uint128_column::uint128_column(size_t count) : m_low(count), m_high(count) {}
+
+	inline uint128_column::uint128_column(size_t count, uint128 value)
+		: m_low(count, value.low_part()), m_high(count, value.high_part()) {}
+
+	inline uint128_column::uint128_column(std::span<const uint128> values) : uint128_column()
+	{
+		assign(values);
+	}
+
+	inline uint128_column::uint128_column(std::initializer_list<uint128> values)
+		: uint128_column(std::span<const uint128>{ values.begin(), values.size() }) {}
+
+	inline size_t uint128_column::size() const noexcept
+	{
+		return m_low.size();
+	}
+
+	inline bool uint128_column::empty() const noexcept
+	{
+		return m_low.empty();
+	}
+
+	inline void uint128_column::reserve(size_t capacity)
+	{
+		m_low.reserve(capacity);
+		m_high.reserve(capacity);
+	}
+
+	inline void uint128_column::resize(size_t count)
+	{
+		m_low.resize(count);
+		m_high.resize(count);
+	}
+
+	inline void uint128_column::clear() noexcept
+	{
+		m_low.clear();
+		m_high.clear();
+	}
+
+	inline void uint128_column::push_back(uint128 value)
+	{
+		m_low.push_back(value.low_part());
+		try
+		{
+			m_high.push_back(value.high_part());
+		}
+		catch (...)
+		{
+			m_low.pop_back();
+			throw;
+		}
+	}
+
+	inline uint128 uint128_column::operator[](size_t index) const noexcept
+	{
+		assert(index < size());
+		return uint128::make_uint128(m_high[index], m_low[index]);
+	}
+
+	inline uint128 uint128_column::at(size_t index) const
+	{
+		if (index >= size())
+		{
+			throw std::out_of_range{ "The index is past the end of the column." };
+		}
+		return (*this)[index];
+	}
+
+	inline void uint128_column::set(size_t index, uint128 value) noexcept
+	{
+		assert(index < size());
+		m_low[index] = value.low_part();
+		m_high[index] = value.high_part();
+	}
+
+	inline std::span<std::uint64_t> uint128_column::low_parts() noexcept
+	{
+		return m_low;
+	}
+
+	inline std::span<const std::uint64_t> uint128_column::low_parts() const noexcept
+	{
+		return m_low;
+	}
+
+	inline std::span<std::uint64_t> uint128_column::high_parts() noexcept
+	{
+		return m_high;
+	}
+
+	inline std::span<const std::uint64_t> uint128_column::high_parts() const noexcept
+	{
+		return m_high;
+	}
+
+	inline void uint128_column::assign(std::span<const uint128> values)
+	{
+		resize(values.size());
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			m_low[i] = values[i].low_part();
+			m_high[i] = values[i].high_part();
+		}
+	}
+
+	inline void uint128_column::copy_to(std::span<uint128> destination) const
+	{
+		if (destination.size() != size())
+		{
+			throw std::invalid_argument{ "The destination must be exactly as long as the column." };
+		}
+		for (size_t i = 0; i < destination.size(); ++i)
+		{
+			destination[i] = uint128::make_uint128(m_high[i], m_low[i]);
+		}
+	}
+
+	inline std::vector<uint128> uint128_column::to_vector() const
+	{
+		auto ret = std::vector<uint128>(size());
+		copy_to(ret);
+		return ret;
+	}
+
+	inline void uint128_column::throw_if_size_differs(const uint128_column& other) const
+	{
+		if (other.size() != size())
+		{
+			throw std::invalid_argument{ "Element-wise operations require columns of the same size." };
+		}
+	}
+
+	inline uint128_column& uint128_column::operator+=(const uint128_column& other)
+	{
+		throw_if_size_differs(other);
+		internal::selected_uint128_column_kernels().add(m_low.data(), m_high.data(), other.m_low.data(),
+			other.m_high.data(), size());
+		return *this;
+	}
+
+	inline uint128_column& uint128_column::operator-=(const uint128_column& other)
+	{
+		throw_if_size_differs(other);
+		internal::selected_uint128_column_kernels().sub(m_low.data(), m_high.data(), other.m_low.data(),
+			other.m_high.data(), size());
+		return *this;
+	}
+
+	inline uint128_column& uint128_column::operator&=(const uint128_column& other)
+	{
+		throw_if_size_differs(other);
+		for (size_t i = 0; i < size(); ++i) { m_low[i] &= other.m_low[i]; }
+		for (size_t i = 0; i < size(); ++i) { m_high[i] &= other.m_high[i]; }
+		return *this;
+	}
+
+	inline uint128_column& uint128_column::operator|=(const uint128_column& other)
+	{
+		throw_if_size_differs(other);
+		for (size_t i = 0; i < size(); ++i) { m_low[i] |= other.m_low[i]; }
+		for (size_t i = 0; i < size(); ++i) { m_high[i] |= other.m_high[i]; }
+		return *this;
+	}
+
+	inline uint128_column& uint128_column::operator^=(const uint128_column& other)
+	{
+		throw_if_size_differs(other);
+		for (size_t i = 0; i < size(); ++i) { m_low[i] ^= other.m_low[i]; }
+		for (size_t i = 0; i < size(); ++i) { m_high[i] ^= other.m_high[i]; }
+		return *this;
+	}
+
+	inline uint128_column& uint128_column::operator<<=(int amount) noexcept
+	{
+		assert(amount >= 0 && amount < 128);
+		std::uint64_t* const low = m_low.data();
+		std::uint64_t* const high = m_high.data();
+		const size_t count = size();
+		//the amount is the same for every element: branch once, outside the loops
+		if (amount >= 64)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				high[i] = low[i] << (amount - 64);
+				low[i] = 0;
+			}
+		}
+		else if (amount > 0)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				high[i] = (high[i] << amount) | (low[i] >> (64 - amount));
+				low[i] <<= amount;
+			}
+		}
+		return *this;
+	}
+
+	inline uint128_column& uint128_column::operator>>=(int amount) noexcept
+	{
+		assert(amount >= 0 && amount < 128);
+		std::uint64_t* const low = m_low.data();
+		std::uint64_t* const high = m_high.data();
+		const size_t count = size();
+		if (amount >= 64)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				low[i] = high[i] >> (amount - 64);
+				high[i] = 0;
+			}
+		}
+		else if (amount > 0)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				low[i] = (low[i] >> amount) | (high[i] << (64 - amount));
+				high[i] >>= amount;
+			}
+		}
+		return *this;
+	}
+
+	inline std::vector<std::int8_t> uint128_column::compare(const uint128_column& lhs, const uint128_column& rhs)
+	{
+		lhs.throw_if_size_differs(rhs);
+		auto ret = std::vector<std::int8_t>(lhs.size());
+		internal::selected_uint128_column_kernels().compare(ret.data(), lhs.m_low.data(), lhs.m_high.data(),
+			rhs.m_low.data(), rhs.m_high.data(), lhs.size());
+		return ret;
+	}
+
+	inline uint128_column uint128_column::min(const uint128_column& lhs, const uint128_column& rhs)
+	{
+		lhs.throw_if_size_differs(rhs);
+		uint128_column ret = lhs;
+		internal::selected_uint128_column_kernels().select(ret.m_low.data(), ret.m_high.data(), rhs.m_low.data(),
+			rhs.m_high.data(), ret.size(), false);
+		return ret;
+	}
+
+	inline uint128_column uint128_column::max(const uint128_column& lhs, const uint128_column& rhs)
+	{
+		lhs.throw_if_size_differs(rhs);
+		uint128_column ret = lhs;
+		internal::selected_uint128_column_kernels().select(ret.m_low.data(), ret.m_high.data(), rhs.m_low.data(),
+			rhs.m_high.data(), ret.size(), true);
+		return ret;
+	}
+
+	inline std::string_view uint128_column::kernel_name() noexcept
+	{
+		return internal::selected_uint128_column_kernels().name;
+	}
+
+	namespace internal
+	{
+		inline void column_add_portable(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+			const std::uint64_t* other_high, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const std::uint64_t sum = low[i] + other_low[i];
+				high[i] += other_high[i] + static_cast<std::uint64_t>(sum < low[i]);
+				low[i] = sum;
+			}
+		}
+
+		inline void column_sub_portable(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+			const std::uint64_t* other_high, size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const std::uint64_t borrow = static_cast<std::uint64_t>(low[i] < other_low[i]);
+				low[i] -= other_low[i];
+				high[i] -= other_high[i] + borrow;
+			}
+		}
+
+		inline void column_compare_portable(std::int8_t* result, const std::uint64_t* lhs_low,
+			const std::uint64_t* lhs_high, const std::uint64_t* rhs_low, const std::uint64_t* rhs_high,
+			size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const bool greater = lhs_high[i] > rhs_high[i] || (lhs_high[i] == rhs_high[i] && lhs_low[i] > rhs_low[i]);
+				const bool less = lhs_high[i] < rhs_high[i] || (lhs_high[i] == rhs_high[i] && lhs_low[i] < rhs_low[i]);
+				result[i] = static_cast<std::int8_t>(static_cast<int>(greater) - static_cast<int>(less));
+			}
+		}
+
+		inline void column_select_portable(std::uint64_t* low, std::uint64_t* high, const std::uint64_t* other_low,
+			const std::uint64_t* other_high, size_t count, bool take_max) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const bool other_less = other_high[i] < high[i] || (other_high[i] == high[i] && other_low[i] < low[i]);
+				const bool other_greater = other_high[i] > high[i] || (other_high[i] == high[i] && other_low[i] > low[i]);
+				if (take_max ? other_greater : other_less)
+				{
+					low[i] = other_low[i];
+					high[i] = other_high[i];
+				}
+			}
+		}
+
+#ifdef CJM_X64_CPU_DISPATCH_AVAILABLE
+		/// <summary>
+		/// AVX2 only compares signed 64-bit lanes: flipping the sign bits of both operands turns the
+		/// signed comparison into an unsigned one.  All ones where lhs > rhs.
+		/// </summary>
+		CJM_TARGET_AVX2 inline __m256i greater_than_u64x4(__m256i lhs, __m256i rhs) noexcept
+		{
+			const __m256i sign_bits = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+			return _mm256_cmpgt_epi64(_mm256_xor_si256(lhs, sign_bits), _mm256_xor_si256(rhs, sign_bits));
+		}
+
+		/// <summary>
+		/// All ones in each lane where the uint128 (lhs_high, lhs_low) > (rhs_high, rhs_low).
+		/// </summary>
+		CJM_TARGET_AVX2 inline __m256i greater_than_u128x4(__m256i lhs_low, __m256i lhs_high, __m256i rhs_low,
+			__m256i rhs_high) noexcept
+		{
+			return _mm256_or_si256(greater_than_u64x4(lhs_high, rhs_high),
+				_mm256_and_si256(_mm256_cmpeq_epi64(lhs_high, rhs_high), greater_than_u64x4(lhs_low, rhs_low)));
+		}
+
+		CJM_TARGET_AVX2 inline __m256i load_u64x4(const std::uint64_t* source) noexcept
+		{
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+		}
+
+		CJM_TARGET_AVX2 inline void store_u64x4(std::uint64_t* destination, __m256i value) noexcept
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value);
+		}
+
+		CJM_TARGET_AVX2 inline void column_add_avx2(std::uint64_t* low, std::uint64_t* high,
+			const std::uint64_t* other_low, const std::uint64_t* other_high, size_t count) noexcept
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i augend_low = load_u64x4(low + i);
+				const __m256i sum_low = _mm256_add_epi64(augend_low, load_u64x4(other_low + i));
+				//the low limb carried where it wrapped below the augend: subtracting the all-ones mask adds one
+				const __m256i carry_mask = greater_than_u64x4(augend_low, sum_low);
+				const __m256i sum_high = _mm256_sub_epi64(_mm256_add_epi64(load_u64x4(high + i),
+					load_u64x4(other_high + i)), carry_mask);
+				store_u64x4(low + i, sum_low);
+				store_u64x4(high + i, sum_high);
+			}
+			column_add_portable(low + i, high + i, other_low + i, other_high + i, count - i);
+		}
+
+		CJM_TARGET_AVX2 inline void column_sub_avx2(std::uint64_t* low, std::uint64_t* high,
+			const std::uint64_t* other_low, const std::uint64_t* other_high, size_t count) noexcept
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i minuend_low = load_u64x4(low + i);
+				const __m256i subtrahend_low = load_u64x4(other_low + i);
+				const __m256i borrow_mask = greater_than_u64x4(subtrahend_low, minuend_low);
+				const __m256i difference_high = _mm256_add_epi64(_mm256_sub_epi64(load_u64x4(high + i),
+					load_u64x4(other_high + i)), borrow_mask);
+				store_u64x4(low + i, _mm256_sub_epi64(minuend_low, subtrahend_low));
+				store_u64x4(high + i, difference_high);
+			}
+			column_sub_portable(low + i, high + i, other_low + i, other_high + i, count - i);
+		}
+
+		CJM_TARGET_AVX2 inline void column_compare_avx2(std::int8_t* result, const std::uint64_t* lhs_low,
+			const std::uint64_t* lhs_high, const std::uint64_t* rhs_low, const std::uint64_t* rhs_high,
+			size_t count) noexcept
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i left_low = load_u64x4(lhs_low + i);
+				const __m256i left_high = load_u64x4(lhs_high + i);
+				const __m256i right_low = load_u64x4(rhs_low + i);
+				const __m256i right_high = load_u64x4(rhs_high + i);
+				const int greater = _mm256_movemask_pd(_mm256_castsi256_pd(
+					greater_than_u128x4(left_low, left_high, right_low, right_high)));
+				const int less = _mm256_movemask_pd(_mm256_castsi256_pd(
+					greater_than_u128x4(right_low, right_high, left_low, left_high)));
+				for (int lane = 0; lane < 4; ++lane)
+				{
+					result[i + lane] = static_cast<std::int8_t>(((greater >> lane) & 1) - ((less >> lane) & 1));
+				}
+			}
+			column_compare_portable(result + i, lhs_low + i, lhs_high + i, rhs_low + i, rhs_high + i, count - i);
+		}
+
+		CJM_TARGET_AVX2 inline void column_select_avx2(std::uint64_t* low, std::uint64_t* high,
+			const std::uint64_t* other_low, const std::uint64_t* other_high, size_t count, bool take_max) noexcept
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i current_low = load_u64x4(low + i);
+				const __m256i current_high = load_u64x4(high + i);
+				const __m256i candidate_low = load_u64x4(other_low + i);
+				const __m256i candidate_high = load_u64x4(other_high + i);
+				const __m256i take_candidate = take_max
+					? greater_than_u128x4(candidate_low, candidate_high, current_low, current_high)
+					: greater_than_u128x4(current_low, current_high, candidate_low, candidate_high);
+				store_u64x4(low + i, _mm256_blendv_epi8(current_low, candidate_low, take_candidate));
+				store_u64x4(high + i, _mm256_blendv_epi8(current_high, candidate_high, take_candidate));
+			}
+			column_select_portable(low + i, high + i, other_low + i, other_high + i, count - i, take_max);
+		}
+#endif
+
+		inline const uint128_column_kernels& selected_uint128_column_kernels() noexcept
+		{
+#if defined(CJM_X64_CPU_DISPATCH_AVAILABLE) && defined(__AVX2__)
+			return avx2_uint128_column_kernels;
+#elif defined(CJM_X64_CPU_DISPATCH_AVAILABLE)
+			static const uint128_column_kernels& kernels = detected_cpu_features().avx2
+				? avx2_uint128_column_kernels : portable_uint128_column_kernels;
+			return kernels;
+#else
+			return portable_uint128_column_kernels;
+#endif
+		}
+	}
+}
+#endif
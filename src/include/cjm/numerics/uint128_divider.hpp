@@ -0,0 +1,190 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_DIVIDER_HPP_
+#define CJM_UINT128_DIVIDER_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+
+namespace cjm::numerics
+{
+	/// <summary>
+	/// Divides any number of dividends by a divisor fixed at construction.
+	/// Construction does the expensive part once (Granlund &amp; Montgomery, "Division by Invariant
+	/// Integers using Multiplication", figure 4.1): powers of two become a shift; any other divisor
+	/// gets a 128-bit magic multiplier, so each division is a multiply-high, an add and two shifts.
+	/// Construction is constexpr, so a divisor known at compile time can be baked into a constexpr divider.
+	/// </summary>
+	class uint128_divider final
+	{
+	public:
+		using divmod_result_t = uint128::divmod_result_t;
+
+		/// <summary>
+		/// Create a divider, reporting a zero divisor by returning std::nullopt.
+		/// </summary>
+		/// <param name="divisor">the divisor</param>
+		/// <returns>A divider for divisor or std::nullopt if divisor is zero.</returns>
+		static constexpr std::optional<uint128_divider> try_make(uint128 divisor) noexcept;
+
+		/// <summary>
+		/// Create a divider.
+		/// </summary>
+		/// <param name="divisor">the divisor</param>
+		/// <exception cref="std::domain_error">divisor is zero.</exception>
+		constexpr explicit uint128_divider(uint128 divisor);
+
+		[[nodiscard]] constexpr uint128 divisor() const noexcept;
+
+		[[nodiscard]] constexpr uint128 divide(uint128 dividend) const noexcept;
+
+		[[nodiscard]] constexpr uint128 modulus(uint128 dividend) const noexcept;
+
+		[[nodiscard]] constexpr divmod_result_t div_mod(uint128 dividend) const noexcept;
+
+		/// <summary>
+		/// Divide each of dividends, storing the quotient and remainder in the corresponding element of out.
+		/// The strategy is chosen once for the whole span, so the loop itself does not branch.
+		/// </summary>
+		/// <param name="dividends">the dividends</param>
+		/// <param name="out">receives the results: must be at least as long as dividends.</param>
+		constexpr void div_mod(std::span<const uint128> dividends, std::span<divmod_result_t> out) const noexcept;
+
+		friend constexpr uint128 operator/(uint128 dividend, const uint128_divider& divider) noexcept;
+
+		friend constexpr uint128 operator%(uint128 dividend, const uint128_divider& divider) noexcept;
+
+		friend constexpr bool operator==(const uint128_divider& lhs, const uint128_divider& rhs) noexcept;
+
+		friend constexpr bool operator!=(const uint128_divider& lhs, const uint128_divider& rhs) noexcept;
+
+	private:
+		enum class strategy : unsigned char
+		{
+			shift,
+			multiply,
+		};
+
+		struct unchecked_t final {};
+
+		constexpr uint128_divider(uint128 divisor, unchecked_t) noexcept;
+
+		static constexpr uint128 compute_magic(uint128 divisor, int log2_ceiling) noexcept;
+
+		[[nodiscard]] constexpr uint128 divide_by_magic(uint128 dividend) const noexcept;
+
+		uint128 m_divisor;
+		uint128 m_magic;
+		int m_shift;
+		strategy m_strategy;
+	};
+
+	/// <summary>
+	/// Divide each of dividends by divisor, storing the quotient and remainder in the corresponding
+	/// element of out.  divisor is checked once for the whole batch and a single uint128_divider is built
+	/// for it: a power of two becomes a shift and a mask, any other divisor a multiply-high per value.
+	/// With max_threads greater than one, large batches are split into slices divided concurrently.
+	/// </summary>
+	/// <param name="dividends">the dividends</param>
+	/// <param name="divisor">the divisor</param>
+	/// <param name="out">receives the results: must be at least as long as dividends.</param>
+	/// <param name="max_threads">the most threads to use, including the calling thread.</param>
+	/// <exception cref="std::domain_error">divisor is zero.</exception>
+	/// <exception cref="std::invalid_argument">out is shorter than dividends.</exception>
+	inline void div_mod(std::span<const uint128> dividends, uint128 divisor,
+		std::span<divmod_result<uint128>> out, unsigned max_threads = 1);
+
+	/// <summary>
+	/// Divide each of dividends by the corresponding element of divisors, storing the quotient and
+	/// remainder in the corresponding element of out.  Every divisor is checked for zero in a single
+	/// pass before any division, so the loop itself neither checks nor throws.
+	/// With max_threads greater than one, large batches are split into slices divided concurrently.
+	/// </summary>
+	/// <param name="dividends">the dividends</param>
+	/// <param name="divisors">the divisors: must be as long as dividends.</param>
+	/// <param name="out">receives the results: must be at least as long as dividends.</param>
+	/// <param name="max_threads">the most threads to use, including the calling thread.</param>
+	/// <exception cref="std::domain_error">one of divisors is zero.</exception>
+	/// <exception cref="std::invalid_argument">the spans' lengths do not match.</exception>
+	inline void div_mod(std::span<const uint128> dividends, std::span<const uint128> divisors,
+		std::span<divmod_result<uint128>> out, unsigned max_threads = 1);
+
+	/// <summary>
+	/// Divide by a divisor known at compile time.  A power of two compiles to a shift.
+	/// Where the rounded-up reciprocal of Divisor fits in 128 bits (10^19 is such a divisor),
+	/// division is a multiply-high and a shift; otherwise it is uint128_divider's
+	/// multiply-high, add and two shifts.  No division instruction or loop is ever emitted.
+	/// </summary>
+	/// <typeparam name="Divisor">the divisor: must not be zero.</typeparam>
+	/// <param name="dividend">the dividend</param>
+	/// <returns>dividend / Divisor</returns>
+	template<uint128 Divisor> requires (Divisor != 0)
+	[[nodiscard]] constexpr uint128 div_by(uint128 dividend) noexcept;
+
+	/// <summary>
+	/// Get the remainder of division by a divisor known at compile time.
+	/// A power of two compiles to a mask; see div_by for other divisors.
+	/// </summary>
+	/// <typeparam name="Divisor">the divisor: must not be zero.</typeparam>
+	/// <param name="dividend">the dividend</param>
+	/// <returns>dividend % Divisor</returns>
+	template<uint128 Divisor> requires (Divisor != 0)
+	[[nodiscard]] constexpr uint128 mod_by(uint128 dividend) noexcept;
+
+	/// <summary>
+	/// Get both quotient and remainder of division by a divisor known at compile time.
+	/// </summary>
+	/// <typeparam name="Divisor">the divisor: must not be zero.</typeparam>
+	/// <param name="dividend">the dividend</param>
+	/// <returns>the quotient and remainder</returns>
+	template<uint128 Divisor> requires (Divisor != 0)
+	[[nodiscard]] constexpr uint128::divmod_result_t div_mod_by(uint128 dividend) noexcept;
+
+	namespace internal
+	{
+		/// <summary>
+		/// floor(numerator * 2^128 / divisor) and the remainder.  numerator must be less than divisor
+		/// so that the quotient fits in 128 bits.  Restoring division, one bit per iteration:
+		/// meant for computing constants, not for hot paths.
+		/// </summary>
+		constexpr divmod_result<uint128> div_mod_shifted(uint128 numerator, uint128 divisor) noexcept;
+
+		/// <summary>
+		/// Everything div_by, mod_by and div_mod_by need to know about Divisor, computed once at compile time.
+		/// </summary>
+		template<uint128 Divisor> requires (Divisor != 0)
+		struct constant_divisor final
+		{
+			static constexpr bool is_power_of_two = (Divisor & (Divisor - 1)) == 0;
+			static constexpr int floor_log2 = std::numeric_limits<uint128>::digits - 1 - countl_zero(Divisor);
+			//ceil(2^(128 + floor_log2) / Divisor): exact for every dividend if it overshoots by at most 2^floor_log2
+			static constexpr divmod_result<uint128> round_down = is_power_of_two
+				? divmod_result<uint128>{} : div_mod_shifted(uint128{ 1 } << floor_log2, Divisor);
+			static constexpr bool has_rounded_up_magic = !is_power_of_two
+				&& Divisor - round_down.remainder <= (uint128{ 1 } << floor_log2);
+			static constexpr uint128 rounded_up_magic = round_down.quotient + 1;
+			static constexpr uint128_divider divider{ Divisor };
+		};
+	}
+}
+#include <cjm/numerics/uint128_divider.inl>
+#endif
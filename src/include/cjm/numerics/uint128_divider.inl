@@ -0,0 +1,250 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_DIVIDER_INL_
+#define CJM_UINT128_DIVIDER_INL_
+#include <cjm/numerics/uint128_divider.hpp>
+
+namespace cjm::numerics
+{
+	constexpr std::optional<uint128_divider> uint128_divider::try_make(uint128 divisor) noexcept
+	{
+		if (divisor == 0)
+		{
+			return std::nullopt;
+		}
+		return std::make_optional(uint128_divider{ divisor, unchecked_t{} });
+	}
+
+	constexpr uint128_divider::uint128_divider(uint128 divisor)
+		: uint128_divider{ divisor != 0 ? divisor
+			: throw std::domain_error{ "Division and/or modulus by zero is forbidden." }, unchecked_t{} } {}
+
+	constexpr uint128_divider::uint128_divider(uint128 divisor, unchecked_t) noexcept
+		: m_divisor{ divisor }, m_magic{}, m_shift{}, m_strategy{}
+	{
+		assert(divisor != 0);
+		if ((divisor & (divisor - 1)) == 0)
+		{
+			m_strategy = strategy::shift;
+			m_shift = std::numeric_limits<uint128>::digits - 1 - countl_zero(divisor);
+		}
+		else
+		{
+			//ceil(log2(divisor)): divisor is not a power of two
+			const int log2_ceiling = std::numeric_limits<uint128>::digits - countl_zero(divisor);
+			m_strategy = strategy::multiply;
+			m_shift = log2_ceiling - 1;
+			m_magic = compute_magic(divisor, log2_ceiling);
+		}
+	}
+
+	constexpr uint128 uint128_divider::compute_magic(uint128 divisor, int log2_ceiling) noexcept
+	{
+		//floor(2^128 * (2^l - d) / d) + 1: (2^l - d) < d, so the quotient fits in 128 bits.
+		//Wraps correctly when l is 128.
+		const uint128 numerator = log2_ceiling == std::numeric_limits<uint128>::digits
+			? uint128{} - divisor
+			: (uint128{ 1 } << log2_ceiling) - divisor;
+		return internal::div_mod_shifted(numerator, divisor).quotient + 1;
+	}
+
+	constexpr uint128 uint128_divider::divisor() const noexcept
+	{
+		return m_divisor;
+	}
+
+	constexpr uint128 uint128_divider::divide(uint128 dividend) const noexcept
+	{
+		if (m_strategy == strategy::shift)
+		{
+			return dividend >> m_shift;
+		}
+		return divide_by_magic(dividend);
+	}
+
+	constexpr uint128 uint128_divider::divide_by_magic(uint128 dividend) const noexcept
+	{
+		//halving the difference keeps the sum from overflowing
+		const uint128 high = mulhi(m_magic, dividend);
+		return (high + ((dividend - high) >> 1)) >> m_shift;
+	}
+
+	constexpr uint128 uint128_divider::modulus(uint128 dividend) const noexcept
+	{
+		return m_strategy == strategy::shift
+			? dividend & (m_divisor - 1)
+			: dividend - divide(dividend) * m_divisor;
+	}
+
+	constexpr uint128_divider::divmod_result_t uint128_divider::div_mod(uint128 dividend) const noexcept
+	{
+		const uint128 quotient = divide(dividend);
+		return divmod_result_t{ quotient, dividend - quotient * m_divisor };
+	}
+
+	constexpr void uint128_divider::div_mod(std::span<const uint128> dividends, std::span<divmod_result_t> out) const noexcept
+	{
+		assert(out.size() >= dividends.size());
+		if (m_strategy == strategy::shift)
+		{
+			const uint128 mask = m_divisor - 1;
+			for (size_t i = 0; i < dividends.size(); ++i)
+			{
+				out[i] = divmod_result_t{ dividends[i] >> m_shift, dividends[i] & mask };
+			}
+		}
+		else
+		{
+			for (size_t i = 0; i < dividends.size(); ++i)
+			{
+				const uint128 quotient = divide_by_magic(dividends[i]);
+				out[i] = divmod_result_t{ quotient, dividends[i] - quotient * m_divisor };
+			}
+		}
+	}
+
+	constexpr uint128 operator/(uint128 dividend, const uint128_divider& divider) noexcept
+	{
+		return divider.divide(dividend);
+	}
+
+	constexpr uint128 operator%(uint128 dividend, const uint128_divider& divider) noexcept
+	{
+		return divider.modulus(dividend);
+	}
+
+	constexpr bool operator==(const uint128_divider& lhs, const uint128_divider& rhs) noexcept
+	{
+		return lhs.m_divisor == rhs.m_divisor;
+	}
+
+	constexpr bool operator!=(const uint128_divider& lhs, const uint128_divider& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	inline void div_mod(std::span<const uint128> dividends, uint128 divisor,
+		std::span<divmod_result<uint128>> out, unsigned max_threads)
+	{
+		if (out.size() < dividends.size())
+		{
+			throw std::invalid_argument{ "The output span is shorter than the dividends." };
+		}
+		if (divisor == 0)
+		{
+			throw std::domain_error{ "Division and/or modulus by zero is forbidden." };
+		}
+		//the magic number is computed once and shared by every slice
+		const auto divider = uint128_divider{ divisor };
+		const auto plan = internal::make_slice_plan(dividends.size(), max_threads);
+		internal::for_each_slice(plan, [&](size_t i) noexcept -> void
+		{
+			divider.div_mod(dividends.subspan(plan.offset(i), plan.length(i)), out.subspan(plan.offset(i), plan.length(i)));
+		});
+	}
+
+	inline void div_mod(std::span<const uint128> dividends, std::span<const uint128> divisors,
+		std::span<divmod_result<uint128>> out, unsigned max_threads)
+	{
+		if (divisors.size() != dividends.size() || out.size() < dividends.size())
+		{
+			throw std::invalid_argument{ "The divisor and output spans must be as long as the dividends." };
+		}
+		bool any_zero = false;
+		for (const uint128 divisor : divisors)
+		{
+			any_zero |= divisor == 0;
+		}
+		if (any_zero)
+		{
+			throw std::domain_error{ "Division and/or modulus by zero is forbidden." };
+		}
+		const auto plan = internal::make_slice_plan(dividends.size(), max_threads);
+		internal::for_each_slice(plan, [&](size_t slice) noexcept -> void
+		{
+			const size_t last = plan.offset(slice) + plan.length(slice);
+			for (size_t i = plan.offset(slice); i < last; ++i)
+			{
+				out[i] = uint128::unsafe_div_mod(dividends[i], divisors[i]);
+			}
+		});
+	}
+
+	template<uint128 Divisor> requires (Divisor != 0)
+	constexpr uint128 div_by(uint128 dividend) noexcept
+	{
+		using traits_t = internal::constant_divisor<Divisor>;
+		if constexpr (traits_t::is_power_of_two)
+		{
+			return dividend >> traits_t::floor_log2;
+		}
+		else if constexpr (traits_t::has_rounded_up_magic)
+		{
+			return mulhi(traits_t::rounded_up_magic, dividend) >> traits_t::floor_log2;
+		}
+		else
+		{
+			return traits_t::divider.divide(dividend);
+		}
+	}
+
+	template<uint128 Divisor> requires (Divisor != 0)
+	constexpr uint128 mod_by(uint128 dividend) noexcept
+	{
+		if constexpr (internal::constant_divisor<Divisor>::is_power_of_two)
+		{
+			return dividend & (Divisor - 1);
+		}
+		else
+		{
+			return dividend - div_by<Divisor>(dividend) * Divisor;
+		}
+	}
+
+	template<uint128 Divisor> requires (Divisor != 0)
+	constexpr uint128::divmod_result_t div_mod_by(uint128 dividend) noexcept
+	{
+		const uint128 quotient = div_by<Divisor>(dividend);
+		return uint128::divmod_result_t{ quotient, dividend - quotient * Divisor };
+	}
+
+	namespace internal
+	{
+		constexpr divmod_result<uint128> div_mod_shifted(uint128 numerator, uint128 divisor) noexcept
+		{
+			assert(numerator < divisor);
+			constexpr int top_bit = std::numeric_limits<std::uint64_t>::digits - 1;
+			uint128 remainder = numerator;
+			uint128 quotient = 0;
+			for (int i = 0; i < std::numeric_limits<uint128>::digits; ++i)
+			{
+				const bool carry = (remainder.high_part() >> top_bit) != 0;
+				remainder <<= 1;
+				quotient <<= 1;
+				if (carry || remainder >= divisor)
+				{
+					remainder -= divisor;
+					quotient |= 1;
+				}
+			}
+			return divmod_result<uint128>{ quotient, remainder };
+		}
+	}
+}
+#endif
@@ -0,0 +1,274 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_FLAT_MAP_HPP_
+#define CJM_UINT128_FLAT_MAP_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#ifdef CJM_DETECTED_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace cjm::numerics
+{
+	namespace internal
+	{
+		using flat_ctrl_t = std::int8_t;
+		//a full slot's control byte holds 7 bits of its key's hash and so is never negative
+		constexpr flat_ctrl_t flat_ctrl_empty = -128;
+		constexpr flat_ctrl_t flat_ctrl_deleted = -2;
+		constexpr size_t flat_group_width = 16;
+
+		/// <summary>
+		/// The control bytes of 16 consecutive slots, matched all at once (with SSE2 where available).
+		/// Each query returns a bit mask: bit i is set if slot i of the group matches.
+		/// </summary>
+		class flat_group final
+		{
+		public:
+			explicit flat_group(const flat_ctrl_t* ctrl) noexcept;
+			[[nodiscard]] std::uint32_t match(flat_ctrl_t hash_bits) const noexcept;
+			[[nodiscard]] std::uint32_t match_empty() const noexcept;
+			[[nodiscard]] std::uint32_t match_empty_or_deleted() const noexcept;
+
+		private:
+#ifdef CJM_DETECTED_SSE2
+			__m128i m_ctrl;
+#else
+			const flat_ctrl_t* m_ctrl;
+#endif
+		};
+	}
+
+	/************************************************************************/
+	/* An open-addressing hash table with uint128 keys, in the style of the
+	 * "Swiss tables" (absl::flat_hash_map): each slot has a control byte
+	 * that is empty, deleted or holds 7 bits of the key's hash; lookups
+	 * compare a group of 16 control bytes against those 7 bits at once
+	 * and only compare keys where they match.  Slots are never
+	 * allocated individually:
+	 *	- control bytes, keys and values each live in their own array, so a
+	 *	  probe reads one cache line of control bytes and then only the keys
+	 *	  it must compare; the values are touched only on a hit;
+	 *	- the control byte doubles as the occupancy flag: no uint128 is
+	 *	  reserved as an "empty" sentinel, so every key may be stored.
+	 *
+	 * Hashing is uint128::hash_code().  The load factor is at most 7/8.
+	 * Any insertion may rehash, which invalidates iterators and references.
+	 * Erasure only invalidates those to the erased element.
+	 *
+	 * Value is the mapped type: see uint128_flat_map<Value> and
+	 * uint128_flat_set (Value = void).  Iteration order is unspecified.
+	 *																		*/
+	/************************************************************************/
+	template<typename Value>
+	class uint128_flat_table final
+	{
+	public:
+		static constexpr bool is_set = std::is_void_v<Value>;
+		using key_type = uint128;
+		using mapped_type = Value;
+		//Value, or a placeholder for sets so that signatures mentioning it stay well-formed
+		using stored_value_type = std::conditional_t<is_set, std::byte, Value>;
+		using value_type = std::conditional_t<is_set, uint128, std::pair<const uint128, stored_value_type>>;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+
+		template<bool IsConst>
+		class basic_iterator final
+		{
+		public:
+			using table_type = std::conditional_t<IsConst, const uint128_flat_table, uint128_flat_table>;
+			using iterator_concept = std::forward_iterator_tag;
+			using iterator_category = std::input_iterator_tag;
+			using value_type = uint128_flat_table::value_type;
+			using difference_type = std::ptrdiff_t;
+			//sets iterate over the (const) keys; maps over (key, value) pairs of references, as the keys
+			//and values are in separate arrays
+			using reference = std::conditional_t<is_set, const uint128&, std::pair<const uint128&,
+				std::conditional_t<IsConst, const stored_value_type&, stored_value_type&>>>;
+
+			basic_iterator() noexcept = default;
+			basic_iterator(table_type* table, size_t index) noexcept : m_table{ table }, m_index{ index } {}
+			template<bool OtherConst>
+				requires (IsConst && !OtherConst)
+			basic_iterator(const basic_iterator<OtherConst>& other) noexcept //NOLINT (iterator to const_iterator)
+				: m_table{ other.m_table }, m_index{ other.m_index } {}
+
+			[[nodiscard]] const uint128& key() const noexcept { return m_table->m_keys[m_index]; }
+			[[nodiscard]] std::conditional_t<IsConst, const stored_value_type&, stored_value_type&> value() const noexcept
+				requires (!is_set) { return m_table->m_values[m_index]; }
+			reference operator*() const noexcept
+			{
+				if constexpr (is_set)
+				{
+					return key();
+				}
+				else
+				{
+					return reference{ key(), value() };
+				}
+			}
+
+			basic_iterator& operator++() noexcept
+			{
+				m_index = m_table->next_full_slot(m_index + 1);
+				return *this;
+			}
+			basic_iterator operator++(int) noexcept
+			{
+				basic_iterator ret = *this;
+				++*this;
+				return ret;
+			}
+
+			friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept
+			{
+				return lhs.m_index == rhs.m_index;
+			}
+
+		private:
+			template<bool> friend class basic_iterator;
+			friend class uint128_flat_table;
+			table_type* m_table = nullptr;
+			size_t m_index = 0;
+		};
+		using iterator = basic_iterator<false>;
+		using const_iterator = basic_iterator<true>;
+
+		uint128_flat_table() noexcept = default;
+		/// <summary>
+		/// Makes a table that can hold at least capacity elements before it rehashes.
+		/// </summary>
+		explicit uint128_flat_table(size_t capacity);
+		uint128_flat_table(const uint128_flat_table& other);
+		uint128_flat_table(uint128_flat_table&& other) noexcept;
+		uint128_flat_table& operator=(const uint128_flat_table& other);
+		uint128_flat_table& operator=(uint128_flat_table&& other) noexcept;
+		~uint128_flat_table();
+
+		[[nodiscard]] size_t size() const noexcept;
+		[[nodiscard]] bool empty() const noexcept;
+		/// <summary>
+		/// The number of slots (a power of two, or zero before anything is inserted).
+		/// </summary>
+		[[nodiscard]] size_t slot_count() const noexcept;
+		[[nodiscard]] double load_factor() const noexcept;
+		/// <summary>
+		/// Makes room for at least count elements without a further rehash.
+		/// </summary>
+		void reserve(size_t count);
+		/// <summary>
+		/// Destroys every element but keeps the slots.
+		/// </summary>
+		void clear() noexcept;
+
+		[[nodiscard]] iterator begin() noexcept;
+		[[nodiscard]] const_iterator begin() const noexcept;
+		[[nodiscard]] const_iterator cbegin() const noexcept;
+		[[nodiscard]] iterator end() noexcept;
+		[[nodiscard]] const_iterator end() const noexcept;
+		[[nodiscard]] const_iterator cend() const noexcept;
+
+		[[nodiscard]] iterator find(uint128 key) noexcept;
+		[[nodiscard]] const_iterator find(uint128 key) const noexcept;
+		[[nodiscard]] bool contains(uint128 key) const noexcept;
+		[[nodiscard]] size_t count(uint128 key) const noexcept;
+
+		std::pair<iterator, bool> insert(uint128 key) requires is_set;
+		std::pair<iterator, bool> insert(uint128 key, const stored_value_type& value) requires (!is_set);
+		std::pair<iterator, bool> insert(uint128 key, stored_value_type&& value) requires (!is_set);
+		/// <summary>
+		/// Constructs the value from args only if key is not already present.
+		/// </summary>
+		template<typename... Args>
+		std::pair<iterator, bool> try_emplace(uint128 key, Args&&... args)
+			requires (!is_set && std::is_constructible_v<stored_value_type, Args...>);
+		template<typename V>
+		std::pair<iterator, bool> insert_or_assign(uint128 key, V&& value)
+			requires (!is_set && std::is_assignable_v<stored_value_type&, V> && std::is_constructible_v<stored_value_type, V>);
+		stored_value_type& operator[](uint128 key) requires (!is_set && std::is_default_constructible_v<stored_value_type>);
+		/// <exception cref="std::out_of_range">key is not present.</exception>
+		stored_value_type& at(uint128 key) requires (!is_set);
+		/// <exception cref="std::out_of_range">key is not present.</exception>
+		const stored_value_type& at(uint128 key) const requires (!is_set);
+
+		/// <summary>
+		/// Bulk insertion: reserves room for every key up front, so the table rehashes at most once,
+		/// and hashes the keys in one batch (see hash_batch) before probing.  Keys already present
+		/// (or repeated) keep their first value.
+		/// </summary>
+		void insert(std::span<const uint128> keys) requires is_set;
+		/// <exception cref="std::invalid_argument">keys and values differ in length.</exception>
+		void insert(std::span<const uint128> keys, std::span<const stored_value_type> values) requires (!is_set);
+		template<std::input_iterator InputIt>
+		void insert(InputIt first, InputIt last);
+
+		size_t erase(uint128 key) noexcept;
+		iterator erase(const_iterator position) noexcept;
+
+	private:
+		static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+		static constexpr size_t max_load_for(size_t slots) noexcept;
+		static constexpr size_t slots_for(size_t count) noexcept;
+
+		[[nodiscard]] size_t find_index(uint128 key, size_t hash) const noexcept;
+		[[nodiscard]] size_t next_full_slot(size_t index) const noexcept;
+		/// <summary>
+		/// Finds key, or claims a slot for it (rehashing if need be) and stores key there.  The
+		/// caller must construct the value in a claimed slot (the bool is true) before anything
+		/// else can throw, or call abandon_slot.
+		/// </summary>
+		std::pair<size_t, bool> find_or_prepare_insert(uint128 key, size_t hash);
+		template<typename... Args>
+		std::pair<size_t, bool> emplace_with_hash(uint128 key, size_t hash, Args&&... args);
+		void abandon_slot(size_t index) noexcept;
+		void erase_at(size_t index) noexcept;
+		static size_t probe_for_insert(const internal::flat_ctrl_t* ctrl, size_t slots, size_t hash) noexcept;
+		void rehash(size_t slots);
+		void set_ctrl(size_t index, internal::flat_ctrl_t ctrl) noexcept;
+		void destroy_all() noexcept;
+		void release() noexcept;
+
+		std::unique_ptr<internal::flat_ctrl_t[]> m_ctrl;
+		std::unique_ptr<uint128[]> m_keys;
+		stored_value_type* m_values = nullptr;
+		size_t m_slots = 0;
+		size_t m_size = 0;
+		size_t m_growth_left = 0;
+	};
+
+	template<typename Value>
+	using uint128_flat_map = uint128_flat_table<Value>;
+
+	using uint128_flat_set = uint128_flat_table<void>;
+}
+#include <cjm/numerics/uint128_flat_map.inl>
+#endif
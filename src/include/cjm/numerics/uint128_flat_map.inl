@@ -0,0 +1,708 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_FLAT_MAP_INL_
+#define CJM_UINT128_FLAT_MAP_INL_
+#include <cjm/numerics/uint128_flat_map.hpp>
+
+namespace cjm::numerics
+{
+	namespace internal
+	{
+#ifdef CJM_DETECTED_SSE2
+		inline flat_group::flat_group(const flat_ctrl_t* ctrl) noexcept
+			: m_ctrl{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)) } {}
+
+		inline std::uint32_t flat_group::match(flat_ctrl_t hash_bits) const noexcept
+		{
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash_bits), m_ctrl)));
+		}
+
+		inline std::uint32_t flat_group::match_empty_or_deleted() const noexcept
+		{
+			//empty and deleted are the only negative control bytes: just gather the sign bits
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(m_ctrl));
+		}
+#else
+		inline flat_group::flat_group(const flat_ctrl_t* ctrl) noexcept : m_ctrl{ ctrl } {}
+
+		inline std::uint32_t flat_group::match(flat_ctrl_t hash_bits) const noexcept
+		{
+			std::uint32_t ret = 0;
+			for (size_t i = 0; i < flat_group_width; ++i)
+			{
+				ret |= static_cast<std::uint32_t>(m_ctrl[i] == hash_bits) << i;
+			}
+			return ret;
+		}
+
+		inline std::uint32_t flat_group::match_empty_or_deleted() const noexcept
+		{
+			std::uint32_t ret = 0;
+			for (size_t i = 0; i < flat_group_width; ++i)
+			{
+				ret |= static_cast<std::uint32_t>(m_ctrl[i] < 0) << i;
+			}
+			return ret;
+		}
+#endif
+
+		inline std::uint32_t flat_group::match_empty() const noexcept
+		{
+			return match(flat_ctrl_empty);
+		}
+
+		constexpr flat_ctrl_t flat_hash_bits(size_t hash) noexcept
+		{
+			return static_cast<flat_ctrl_t>(hash & 0x7f);
+		}
+
+		constexpr size_t flat_first_group(size_t hash, size_t group_mask) noexcept
+		{
+			return (hash >> 7) & group_mask;
+		}
+	}
+
+	template<typename Value>
+	uint128_flat_table<Value>::uint128_flat_table(size_t capacity) : uint128_flat_table()
+	{
+		reserve(capacity);
+	}
+
+	template<typename Value>
+	uint128_flat_table<Value>::uint128_flat_table(const uint128_flat_table& other) : uint128_flat_table()
+	{
+		if (other.m_size == 0)
+		{
+			return;
+		}
+		//same slot count, so every element can go in the same slot as in other
+		auto ctrl = std::make_unique<internal::flat_ctrl_t[]>(other.m_slots);
+		auto keys = std::make_unique<uint128[]>(other.m_slots);
+		std::copy_n(other.m_ctrl.get(), other.m_slots, ctrl.get());
+		std::copy_n(other.m_keys.get(), other.m_slots, keys.get());
+		if constexpr (!is_set)
+		{
+			auto allocator = std::allocator<stored_value_type>{};
+			stored_value_type* values = allocator.allocate(other.m_slots);
+			size_t index = 0;
+			try
+			{
+				for (; index < other.m_slots; ++index)
+				{
+					if (ctrl[index] >= 0)
+					{
+						std::construct_at(values + index, other.m_values[index]);
+					}
+				}
+			}
+			catch (...)
+			{
+				for (size_t constructed = 0; constructed < index; ++constructed)
+				{
+					if (ctrl[constructed] >= 0)
+					{
+						std::destroy_at(values + constructed);
+					}
+				}
+				allocator.deallocate(values, other.m_slots);
+				throw;
+			}
+			m_values = values;
+		}
+		m_ctrl = std::move(ctrl);
+		m_keys = std::move(keys);
+		m_slots = other.m_slots;
+		m_size = other.m_size;
+		m_growth_left = other.m_growth_left;
+	}
+
+	template<typename Value>
+	uint128_flat_table<Value>::uint128_flat_table(uint128_flat_table&& other) noexcept
+		: m_ctrl{ std::move(other.m_ctrl) }, m_keys{ std::move(other.m_keys) },
+		m_values{ std::exchange(other.m_values, nullptr) }, m_slots{ std::exchange(other.m_slots, 0) },
+		m_size{ std::exchange(other.m_size, 0) }, m_growth_left{ std::exchange(other.m_growth_left, 0) } {}
+
+	template<typename Value>
+	uint128_flat_table<Value>& uint128_flat_table<Value>::operator=(const uint128_flat_table& other)
+	{
+		if (this != &other)
+		{
+			*this = uint128_flat_table{ other };
+		}
+		return *this;
+	}
+
+	template<typename Value>
+	uint128_flat_table<Value>& uint128_flat_table<Value>::operator=(uint128_flat_table&& other) noexcept
+	{
+		if (this != &other)
+		{
+			release();
+			m_ctrl = std::move(other.m_ctrl);
+			m_keys = std::move(other.m_keys);
+			m_values = std::exchange(other.m_values, nullptr);
+			m_slots = std::exchange(other.m_slots, 0);
+			m_size = std::exchange(other.m_size, 0);
+			m_growth_left = std::exchange(other.m_growth_left, 0);
+		}
+		return *this;
+	}
+
+	template<typename Value>
+	uint128_flat_table<Value>::~uint128_flat_table()
+	{
+		release();
+	}
+
+	template<typename Value>
+	size_t uint128_flat_table<Value>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template<typename Value>
+	bool uint128_flat_table<Value>::empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template<typename Value>
+	size_t uint128_flat_table<Value>::slot_count() const noexcept
+	{
+		return m_slots;
+	}
+
+	template<typename Value>
+	double uint128_flat_table<Value>::load_factor() const noexcept
+	{
+		return m_slots == 0 ? 0.0 : static_cast<double>(m_size) / static_cast<double>(m_slots);
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::reserve(size_t count)
+	{
+		if (count > max_load_for(m_slots))
+		{
+			rehash(slots_for(count));
+		}
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::clear() noexcept
+	{
+		destroy_all();
+		std::fill_n(m_ctrl.get(), m_slots, internal::flat_ctrl_empty);
+		m_size = 0;
+		m_growth_left = max_load_for(m_slots);
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::iterator uint128_flat_table<Value>::begin() noexcept
+	{
+		return iterator{ this, next_full_slot(0) };
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::const_iterator uint128_flat_table<Value>::begin() const noexcept
+	{
+		return const_iterator{ this, next_full_slot(0) };
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::const_iterator uint128_flat_table<Value>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::iterator uint128_flat_table<Value>::end() noexcept
+	{
+		return iterator{ this, m_slots };
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::const_iterator uint128_flat_table<Value>::end() const noexcept
+	{
+		return const_iterator{ this, m_slots };
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::const_iterator uint128_flat_table<Value>::cend() const noexcept
+	{
+		return end();
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::iterator uint128_flat_table<Value>::find(uint128 key) noexcept
+	{
+		const size_t index = find_index(key, key.hash_code());
+		return iterator{ this, index == npos ? m_slots : index };
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::const_iterator uint128_flat_table<Value>::find(uint128 key) const noexcept
+	{
+		const size_t index = find_index(key, key.hash_code());
+		return const_iterator{ this, index == npos ? m_slots : index };
+	}
+
+	template<typename Value>
+	bool uint128_flat_table<Value>::contains(uint128 key) const noexcept
+	{
+		return find_index(key, key.hash_code()) != npos;
+	}
+
+	template<typename Value>
+	size_t uint128_flat_table<Value>::count(uint128 key) const noexcept
+	{
+		return contains(key) ? 1 : 0;
+	}
+
+	template<typename Value>
+	std::pair<typename uint128_flat_table<Value>::iterator, bool> uint128_flat_table<Value>::insert(uint128 key)
+		requires is_set
+	{
+		const auto [index, inserted] = find_or_prepare_insert(key, key.hash_code());
+		return { iterator{ this, index }, inserted };
+	}
+
+	template<typename Value>
+	std::pair<typename uint128_flat_table<Value>::iterator, bool> uint128_flat_table<Value>::insert(uint128 key,
+		const stored_value_type& value) requires (!is_set)
+	{
+		return try_emplace(key, value);
+	}
+
+	template<typename Value>
+	std::pair<typename uint128_flat_table<Value>::iterator, bool> uint128_flat_table<Value>::insert(uint128 key,
+		stored_value_type&& value) requires (!is_set)
+	{
+		return try_emplace(key, std::move(value));
+	}
+
+	template<typename Value>
+	template<typename... Args>
+	std::pair<typename uint128_flat_table<Value>::iterator, bool> uint128_flat_table<Value>::try_emplace(uint128 key,
+		Args&&... args) requires (!is_set && std::is_constructible_v<stored_value_type, Args...>)
+	{
+		const auto [index, inserted] = emplace_with_hash(key, key.hash_code(), std::forward<Args>(args)...);
+		return { iterator{ this, index }, inserted };
+	}
+
+	template<typename Value>
+	template<typename V>
+	std::pair<typename uint128_flat_table<Value>::iterator, bool> uint128_flat_table<Value>::insert_or_assign(uint128 key,
+		V&& value) requires (!is_set && std::is_assignable_v<stored_value_type&, V> && std::is_constructible_v<stored_value_type, V>)
+	{
+		const auto [index, inserted] = find_or_prepare_insert(key, key.hash_code());
+		if (inserted)
+		{
+			try
+			{
+				std::construct_at(m_values + index, std::forward<V>(value));
+			}
+			catch (...)
+			{
+				abandon_slot(index);
+				throw;
+			}
+		}
+		else
+		{
+			m_values[index] = std::forward<V>(value);
+		}
+		return { iterator{ this, index }, inserted };
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::stored_value_type& uint128_flat_table<Value>::operator[](uint128 key)
+		requires (!is_set && std::is_default_constructible_v<stored_value_type>)
+	{
+		//the insertion may rehash: only read m_values after it
+		const size_t index = emplace_with_hash(key, key.hash_code()).first;
+		return m_values[index];
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::stored_value_type& uint128_flat_table<Value>::at(uint128 key)
+		requires (!is_set)
+	{
+		const size_t index = find_index(key, key.hash_code());
+		if (index == npos)
+		{
+			throw std::out_of_range{ "The key is not in the map." };
+		}
+		return m_values[index];
+	}
+
+	template<typename Value>
+	const typename uint128_flat_table<Value>::stored_value_type& uint128_flat_table<Value>::at(uint128 key) const
+		requires (!is_set)
+	{
+		const size_t index = find_index(key, key.hash_code());
+		if (index == npos)
+		{
+			throw std::out_of_range{ "The key is not in the map." };
+		}
+		return m_values[index];
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::insert(std::span<const uint128> keys) requires is_set
+	{
+		reserve(m_size + keys.size());
+		constexpr size_t chunk_size = 256;
+		std::array<size_t, chunk_size> hashes{};
+		for (size_t start = 0; start < keys.size(); start += chunk_size)
+		{
+			const auto chunk = keys.subspan(start, std::min(chunk_size, keys.size() - start));
+			hash_batch(chunk, std::span<size_t>{ hashes }.first(chunk.size()));
+			for (size_t i = 0; i < chunk.size(); ++i)
+			{
+				find_or_prepare_insert(chunk[i], hashes[i]);
+			}
+		}
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::insert(std::span<const uint128> keys, std::span<const stored_value_type> values)
+		requires (!is_set)
+	{
+		if (keys.size() != values.size())
+		{
+			throw std::invalid_argument{ "There must be exactly one value per key." };
+		}
+		reserve(m_size + keys.size());
+		constexpr size_t chunk_size = 256;
+		std::array<size_t, chunk_size> hashes{};
+		for (size_t start = 0; start < keys.size(); start += chunk_size)
+		{
+			const size_t length = std::min(chunk_size, keys.size() - start);
+			hash_batch(keys.subspan(start, length), std::span<size_t>{ hashes }.first(length));
+			for (size_t i = 0; i < length; ++i)
+			{
+				emplace_with_hash(keys[start + i], hashes[i], values[start + i]);
+			}
+		}
+	}
+
+	template<typename Value>
+	template<std::input_iterator InputIt>
+	void uint128_flat_table<Value>::insert(InputIt first, InputIt last)
+	{
+		if constexpr (std::forward_iterator<InputIt>)
+		{
+			reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+		}
+		for (; first != last; ++first)
+		{
+			if constexpr (is_set)
+			{
+				insert(static_cast<uint128>(*first));
+			}
+			else
+			{
+				auto&& element = *first;
+				try_emplace(static_cast<uint128>(std::get<0>(element)), std::get<1>(element));
+			}
+		}
+	}
+
+	template<typename Value>
+	size_t uint128_flat_table<Value>::erase(uint128 key) noexcept
+	{
+		const size_t index = find_index(key, key.hash_code());
+		if (index == npos)
+		{
+			return 0;
+		}
+		erase_at(index);
+		return 1;
+	}
+
+	template<typename Value>
+	typename uint128_flat_table<Value>::iterator uint128_flat_table<Value>::erase(const_iterator position) noexcept
+	{
+		assert(position.m_table == this && position.m_index < m_slots && m_ctrl[position.m_index] >= 0);
+		erase_at(position.m_index);
+		return iterator{ this, next_full_slot(position.m_index + 1) };
+	}
+
+	template<typename Value>
+	constexpr size_t uint128_flat_table<Value>::max_load_for(size_t slots) noexcept
+	{
+		return slots - slots / 8;
+	}
+
+	template<typename Value>
+	constexpr size_t uint128_flat_table<Value>::slots_for(size_t count) noexcept
+	{
+		size_t slots = std::max(internal::flat_group_width, std::bit_ceil(count));
+		while (max_load_for(slots) < count)
+		{
+			slots *= 2;
+		}
+		return slots;
+	}
+
+	template<typename Value>
+	size_t uint128_flat_table<Value>::find_index(uint128 key, size_t hash) const noexcept
+	{
+		if (m_slots == 0)
+		{
+			return npos;
+		}
+		const size_t group_mask = m_slots / internal::flat_group_width - 1;
+		const internal::flat_ctrl_t hash_bits = internal::flat_hash_bits(hash);
+		size_t group = internal::flat_first_group(hash, group_mask);
+		//triangular steps visit every group once when the group count is a power of two
+		for (size_t step = 1; ; ++step)
+		{
+			const size_t base = group * internal::flat_group_width;
+			const internal::flat_group control{ m_ctrl.get() + base };
+			for (std::uint32_t candidates = control.match(hash_bits); candidates != 0; candidates &= candidates - 1)
+			{
+				const size_t index = base + static_cast<size_t>(std::countr_zero(candidates));
+				if (m_keys[index] == key)
+				{
+					return index;
+				}
+			}
+			if (control.match_empty() != 0)
+			{
+				return npos;
+			}
+			group = (group + step) & group_mask;
+		}
+	}
+
+	template<typename Value>
+	size_t uint128_flat_table<Value>::probe_for_insert(const internal::flat_ctrl_t* ctrl, size_t slots,
+		size_t hash) noexcept
+	{
+		const size_t group_mask = slots / internal::flat_group_width - 1;
+		size_t group = internal::flat_first_group(hash, group_mask);
+		for (size_t step = 1; ; ++step)
+		{
+			const size_t base = group * internal::flat_group_width;
+			const std::uint32_t available = internal::flat_group{ ctrl + base }.match_empty_or_deleted();
+			if (available != 0)
+			{
+				return base + static_cast<size_t>(std::countr_zero(available));
+			}
+			group = (group + step) & group_mask;
+		}
+	}
+
+	template<typename Value>
+	size_t uint128_flat_table<Value>::next_full_slot(size_t index) const noexcept
+	{
+		while (index < m_slots && m_ctrl[index] < 0)
+		{
+			++index;
+		}
+		return index;
+	}
+
+	template<typename Value>
+	std::pair<size_t, bool> uint128_flat_table<Value>::find_or_prepare_insert(uint128 key, size_t hash)
+	{
+		if (const size_t found = find_index(key, hash); found != npos)
+		{
+			return { found, false };
+		}
+		if (m_slots == 0)
+		{
+			rehash(slots_for(1));
+		}
+		size_t index = probe_for_insert(m_ctrl.get(), m_slots, hash);
+		if (m_growth_left == 0 && m_ctrl[index] == internal::flat_ctrl_empty)
+		{
+			//out of room: purge the tombstones in place if they are what fills the table, else grow
+			rehash(m_size + 1 > max_load_for(m_slots) / 2 ? m_slots * 2 : m_slots);
+			index = probe_for_insert(m_ctrl.get(), m_slots, hash);
+		}
+		if (m_ctrl[index] == internal::flat_ctrl_empty)
+		{
+			--m_growth_left;
+		}
+		set_ctrl(index, internal::flat_hash_bits(hash));
+		m_keys[index] = key;
+		++m_size;
+		return { index, true };
+	}
+
+	template<typename Value>
+	template<typename... Args>
+	std::pair<size_t, bool> uint128_flat_table<Value>::emplace_with_hash(uint128 key, size_t hash, Args&&... args)
+	{
+		const auto ret = find_or_prepare_insert(key, hash);
+		if constexpr (!is_set)
+		{
+			if (ret.second)
+			{
+				try
+				{
+					std::construct_at(m_values + ret.first, std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					abandon_slot(ret.first);
+					throw;
+				}
+			}
+		}
+		return ret;
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::abandon_slot(size_t index) noexcept
+	{
+		//the slot may have been empty and so counted against m_growth_left: a tombstone keeps the count right
+		set_ctrl(index, internal::flat_ctrl_deleted);
+		--m_size;
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::erase_at(size_t index) noexcept
+	{
+		if constexpr (!is_set)
+		{
+			std::destroy_at(m_values + index);
+		}
+		//a lookup stops at the first group with an empty slot.  If this slot's group already has one,
+		//no probe sequence passes through the group, so this slot can become empty too.
+		const size_t base = index & ~(internal::flat_group_width - 1);
+		if (internal::flat_group{ m_ctrl.get() + base }.match_empty() != 0)
+		{
+			set_ctrl(index, internal::flat_ctrl_empty);
+			++m_growth_left;
+		}
+		else
+		{
+			set_ctrl(index, internal::flat_ctrl_deleted);
+		}
+		--m_size;
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::rehash(size_t slots)
+	{
+		assert(std::has_single_bit(slots) && slots >= internal::flat_group_width && max_load_for(slots) >= m_size);
+		auto ctrl = std::make_unique<internal::flat_ctrl_t[]>(slots);
+		auto keys = std::make_unique<uint128[]>(slots);
+		std::fill_n(ctrl.get(), slots, internal::flat_ctrl_empty);
+		stored_value_type* values = nullptr;
+		if constexpr (!is_set)
+		{
+			auto allocator = std::allocator<stored_value_type>{};
+			values = allocator.allocate(slots);
+			try
+			{
+				for (size_t index = 0; index < m_slots; ++index)
+				{
+					if (m_ctrl[index] >= 0)
+					{
+						const size_t hash = m_keys[index].hash_code();
+						const size_t destination = probe_for_insert(ctrl.get(), slots, hash);
+						//copies unless moving cannot throw, so a failure leaves this table as it was
+						std::construct_at(values + destination, std::move_if_noexcept(m_values[index]));
+						ctrl[destination] = internal::flat_hash_bits(hash);
+						keys[destination] = m_keys[index];
+					}
+				}
+			}
+			catch (...)
+			{
+				for (size_t index = 0; index < slots; ++index)
+				{
+					if (ctrl[index] >= 0)
+					{
+						std::destroy_at(values + index);
+					}
+				}
+				allocator.deallocate(values, slots);
+				throw;
+			}
+		}
+		else
+		{
+			for (size_t index = 0; index < m_slots; ++index)
+			{
+				if (m_ctrl[index] >= 0)
+				{
+					const size_t hash = m_keys[index].hash_code();
+					const size_t destination = probe_for_insert(ctrl.get(), slots, hash);
+					ctrl[destination] = internal::flat_hash_bits(hash);
+					keys[destination] = m_keys[index];
+				}
+			}
+		}
+		const size_t size = m_size;
+		release();
+		m_ctrl = std::move(ctrl);
+		m_keys = std::move(keys);
+		m_values = values;
+		m_slots = slots;
+		m_size = size;
+		m_growth_left = max_load_for(slots) - size;
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::set_ctrl(size_t index, internal::flat_ctrl_t ctrl) noexcept
+	{
+		assert(index < m_slots);
+		m_ctrl[index] = ctrl;
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::destroy_all() noexcept
+	{
+		if constexpr (!is_set && !std::is_trivially_destructible_v<stored_value_type>)
+		{
+			for (size_t index = 0; index < m_slots; ++index)
+			{
+				if (m_ctrl[index] >= 0)
+				{
+					std::destroy_at(m_values + index);
+				}
+			}
+		}
+	}
+
+	template<typename Value>
+	void uint128_flat_table<Value>::release() noexcept
+	{
+		destroy_all();
+		if constexpr (!is_set)
+		{
+			if (m_values != nullptr)
+			{
+				std::allocator<stored_value_type>{}.deallocate(m_values, m_slots);
+				m_values = nullptr;
+			}
+		}
+		m_ctrl.reset();
+		m_keys.reset();
+		m_slots = 0;
+		m_size = 0;
+		m_growth_left = 0;
+	}
+}
+#endif
@@ -0,0 +1,162 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_MODULAR_HPP_
+#define CJM_UINT128_MODULAR_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+
+namespace cjm::numerics
+{
+	template<typename UInt>
+	class montgomery_context;
+
+	template<typename UInt>
+	class barrett_context;
+
+	/// <summary>
+	/// Modular arithmetic with a fixed odd modulus in Montgomery form: the residue a is represented
+	/// by a * 2^128 mod modulus, which turns the reduction after each multiplication into two
+	/// multiplications, an addition and a conditional subtraction (REDC) with no division.
+	/// Construction does all the division there is (computing -modulus^-1 mod 2^128 by Newton's
+	/// iteration and 2^256 mod modulus by doubling) and is constexpr.
+	///
+	/// mul, sqr, add, sub and pow take and return values in Montgomery form, each less than
+	/// modulus(): convert with to_mont and from_mont at the ends of a computation.
+	/// </summary>
+	template<>
+	class montgomery_context<uint128> final
+	{
+	public:
+		/// <summary>
+		/// Create a context, reporting an even modulus or one less than three by returning std::nullopt.
+		/// </summary>
+		static constexpr std::optional<montgomery_context> try_make(uint128 modulus) noexcept;
+
+		/// <exception cref="std::domain_error">modulus is even or less than three.</exception>
+		constexpr explicit montgomery_context(uint128 modulus);
+
+		[[nodiscard]] constexpr uint128 modulus() const noexcept;
+		/// <summary>
+		/// One in Montgomery form (2^128 mod modulus).
+		/// </summary>
+		[[nodiscard]] constexpr uint128 one() const noexcept;
+
+		/// <summary>
+		/// value (any uint128, not just one less than modulus) in Montgomery form.
+		/// </summary>
+		[[nodiscard]] constexpr uint128 to_mont(uint128 value) const noexcept;
+		[[nodiscard]] constexpr uint128 from_mont(uint128 mont) const noexcept;
+
+		[[nodiscard]] constexpr uint128 mul(uint128 lhs, uint128 rhs) const noexcept;
+		[[nodiscard]] constexpr uint128 sqr(uint128 value) const noexcept;
+		[[nodiscard]] constexpr uint128 add(uint128 lhs, uint128 rhs) const noexcept;
+		[[nodiscard]] constexpr uint128 sub(uint128 lhs, uint128 rhs) const noexcept;
+		/// <summary>
+		/// base^exponent by right-to-left square and multiply, base and result in Montgomery form.
+		/// </summary>
+		[[nodiscard]] constexpr uint128 pow(uint128 base, uint128 exponent) const noexcept;
+
+		/// <summary>
+		/// Montgomery reduction: product * 2^-128 mod modulus.
+		/// </summary>
+		/// <param name="product">a 256-bit value whose high half is less than modulus.</param>
+		[[nodiscard]] constexpr uint128 reduce(u128_wide_product product) const noexcept;
+
+		friend constexpr bool operator==(const montgomery_context& lhs, const montgomery_context& rhs) noexcept = default;
+
+	private:
+		struct unchecked_t final {};
+
+		constexpr montgomery_context(uint128 modulus, unchecked_t) noexcept;
+
+		uint128 m_modulus;
+		//-modulus^-1 mod 2^128
+		uint128 m_neg_inverse;
+		//2^128 mod modulus and 2^256 mod modulus
+		uint128 m_r_mod;
+		uint128 m_r_squared_mod;
+	};
+
+	/// <summary>
+	/// Modular arithmetic with a fixed modulus (odd or even) by Barrett reduction: construction
+	/// computes floor(2^256 / modulus) once, after which the remainder of a 256-bit product is found
+	/// by multiplying by that reciprocal, with no division.  Construction is constexpr.
+	///
+	/// Values are ordinary residues: mul, sqr, add, sub and pow take operands less than modulus().
+	/// montgomery_context is faster for odd moduli.
+	/// </summary>
+	template<>
+	class barrett_context<uint128> final
+	{
+	public:
+		/// <summary>
+		/// Create a context, reporting a modulus less than two by returning std::nullopt.
+		/// </summary>
+		static constexpr std::optional<barrett_context> try_make(uint128 modulus) noexcept;
+
+		/// <exception cref="std::domain_error">modulus is less than two.</exception>
+		constexpr explicit barrett_context(uint128 modulus);
+
+		[[nodiscard]] constexpr uint128 modulus() const noexcept;
+
+		/// <summary>
+		/// value mod modulus() for any uint128.
+		/// </summary>
+		[[nodiscard]] constexpr uint128 reduce(uint128 value) const noexcept;
+		/// <summary>
+		/// value mod modulus().
+		/// </summary>
+		/// <param name="value">a 256-bit value whose high half is less than modulus.</param>
+		[[nodiscard]] constexpr uint128 reduce(u128_wide_product value) const noexcept;
+
+		[[nodiscard]] constexpr uint128 mul(uint128 lhs, uint128 rhs) const noexcept;
+		[[nodiscard]] constexpr uint128 sqr(uint128 value) const noexcept;
+		[[nodiscard]] constexpr uint128 add(uint128 lhs, uint128 rhs) const noexcept;
+		[[nodiscard]] constexpr uint128 sub(uint128 lhs, uint128 rhs) const noexcept;
+		[[nodiscard]] constexpr uint128 pow(uint128 base, uint128 exponent) const noexcept;
+
+		friend constexpr bool operator==(const barrett_context& lhs, const barrett_context& rhs) noexcept = default;
+
+	private:
+		struct unchecked_t final {};
+
+		constexpr barrett_context(uint128 modulus, unchecked_t) noexcept;
+
+		uint128 m_modulus;
+		//floor(2^256 / modulus)
+		u128_wide_product m_reciprocal;
+	};
+
+	namespace internal
+	{
+		/// <summary>
+		/// (lhs + rhs) mod modulus for lhs and rhs less than modulus, even when the sum overflows.
+		/// </summary>
+		constexpr uint128 add_mod(uint128 lhs, uint128 rhs, uint128 modulus) noexcept;
+		/// <summary>
+		/// (lhs - rhs) mod modulus for lhs and rhs less than modulus.
+		/// </summary>
+		constexpr uint128 sub_mod(uint128 lhs, uint128 rhs, uint128 modulus) noexcept;
+	}
+}
+#include <cjm/numerics/uint128_modular.inl>
+#endif
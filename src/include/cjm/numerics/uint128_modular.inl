@@ -0,0 +1,248 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_MODULAR_INL_
+#define CJM_UINT128_MODULAR_INL_
+#include <cjm/numerics/uint128_modular.hpp>
+
+namespace cjm::numerics
+{
+	namespace internal
+	{
+		constexpr uint128 add_mod(uint128 lhs, uint128 rhs, uint128 modulus) noexcept
+		{
+			assert(lhs < modulus && rhs < modulus);
+			const uint128 sum = lhs + rhs;
+			//if the sum wrapped, the true sum exceeds modulus and wrapping back is right
+			return (sum < lhs || sum >= modulus) ? sum - modulus : sum;
+		}
+
+		constexpr uint128 sub_mod(uint128 lhs, uint128 rhs, uint128 modulus) noexcept
+		{
+			assert(lhs < modulus && rhs < modulus);
+			const uint128 difference = lhs - rhs;
+			return lhs < rhs ? difference + modulus : difference;
+		}
+	}
+
+	constexpr std::optional<montgomery_context<uint128>> montgomery_context<uint128>::try_make(uint128 modulus) noexcept
+	{
+		if ((modulus & 1) == 0 || modulus < 3)
+		{
+			return std::nullopt;
+		}
+		return std::make_optional(montgomery_context{ modulus, unchecked_t{} });
+	}
+
+	constexpr montgomery_context<uint128>::montgomery_context(uint128 modulus)
+		: montgomery_context{ (modulus & 1) != 0 && modulus >= 3 ? modulus
+			: throw std::domain_error{ "A Montgomery modulus must be odd and at least three." }, unchecked_t{} } {}
+
+	constexpr montgomery_context<uint128>::montgomery_context(uint128 modulus, unchecked_t) noexcept
+		: m_modulus{ modulus }, m_neg_inverse{}, m_r_mod{}, m_r_squared_mod{}
+	{
+		//modulus is its own inverse mod 8; each Newton step doubles the number of correct bits: 3, 6 ... 192
+		uint128 inverse = modulus;
+		for (int i = 0; i < 6; ++i)
+		{
+			inverse *= 2 - modulus * inverse;
+		}
+		assert(modulus * inverse == 1);
+		m_neg_inverse = 0 - inverse;
+		//2^128 mod modulus is (2^128 - modulus) mod modulus; doubling it 128 times gives 2^256 mod modulus
+		m_r_mod = (0 - modulus) % modulus;
+		m_r_squared_mod = m_r_mod;
+		for (int i = 0; i < 128; ++i)
+		{
+			m_r_squared_mod = internal::add_mod(m_r_squared_mod, m_r_squared_mod, modulus);
+		}
+	}
+
+	constexpr uint128 montgomery_context<uint128>::modulus() const noexcept
+	{
+		return m_modulus;
+	}
+
+	constexpr uint128 montgomery_context<uint128>::one() const noexcept
+	{
+		return m_r_mod;
+	}
+
+	constexpr uint128 montgomery_context<uint128>::reduce(u128_wide_product product) const noexcept
+	{
+		assert(product.high < m_modulus);
+		//adding m * modulus makes the low half zero, so the sum divided by 2^128 is its high half
+		const uint128 m = product.low * m_neg_inverse;
+		const u128_wide_product correction = wide_multiply(m, m_modulus);
+		//the low halves sum to exactly 2^128 (carrying one) unless both are zero
+		const uint128 low_carry = product.low != 0 ? 1 : 0;
+		const uint128 partial = product.high + correction.high;
+		const uint128 result = partial + low_carry;
+		//the result is less than 2 * modulus, but may have overflowed 128 bits getting there
+		const bool overflowed = partial < product.high || result < partial;
+		return (overflowed || result >= m_modulus) ? result - m_modulus : result;
+	}
+
+	constexpr uint128 montgomery_context<uint128>::to_mont(uint128 value) const noexcept
+	{
+		//value * 2^256 * 2^-128: value need not be reduced first since value * (2^256 mod modulus) < 2^128 * modulus
+		return reduce(wide_multiply(value, m_r_squared_mod));
+	}
+
+	constexpr uint128 montgomery_context<uint128>::from_mont(uint128 mont) const noexcept
+	{
+		return reduce(u128_wide_product{ 0, mont });
+	}
+
+	constexpr uint128 montgomery_context<uint128>::mul(uint128 lhs, uint128 rhs) const noexcept
+	{
+		assert(lhs < m_modulus && rhs < m_modulus);
+		return reduce(wide_multiply(lhs, rhs));
+	}
+
+	constexpr uint128 montgomery_context<uint128>::sqr(uint128 value) const noexcept
+	{
+		return mul(value, value);
+	}
+
+	constexpr uint128 montgomery_context<uint128>::add(uint128 lhs, uint128 rhs) const noexcept
+	{
+		return internal::add_mod(lhs, rhs, m_modulus);
+	}
+
+	constexpr uint128 montgomery_context<uint128>::sub(uint128 lhs, uint128 rhs) const noexcept
+	{
+		return internal::sub_mod(lhs, rhs, m_modulus);
+	}
+
+	constexpr uint128 montgomery_context<uint128>::pow(uint128 base, uint128 exponent) const noexcept
+	{
+		assert(base < m_modulus);
+		uint128 result = one();
+		for (; exponent != 0; exponent >>= 1)
+		{
+			if ((exponent & 1) != 0)
+			{
+				result = mul(result, base);
+			}
+			base = sqr(base);
+		}
+		return result;
+	}
+
+	constexpr std::optional<barrett_context<uint128>> barrett_context<uint128>::try_make(uint128 modulus) noexcept
+	{
+		if (modulus < 2)
+		{
+			return std::nullopt;
+		}
+		return std::make_optional(barrett_context{ modulus, unchecked_t{} });
+	}
+
+	constexpr barrett_context<uint128>::barrett_context(uint128 modulus)
+		: barrett_context{ modulus >= 2 ? modulus
+			: throw std::domain_error{ "A Barrett modulus must be at least two." }, unchecked_t{} } {}
+
+	constexpr barrett_context<uint128>::barrett_context(uint128 modulus, unchecked_t) noexcept
+		: m_modulus{ modulus }, m_reciprocal{}
+	{
+		//long division of 2^256 by modulus, one bit at a time.  The leading one is less than modulus,
+		//so it only seeds the remainder; the 256 zero bits after it give the 256 quotient bits.
+		uint128 remainder = 1;
+		for (int i = 0; i < 256; ++i)
+		{
+			const bool carried = (remainder >> 127) != 0;
+			remainder <<= 1;
+			const bool subtract = carried || remainder >= modulus;
+			if (subtract)
+			{
+				remainder -= modulus;
+			}
+			m_reciprocal.high = (m_reciprocal.high << 1) | (m_reciprocal.low >> 127);
+			m_reciprocal.low = (m_reciprocal.low << 1) | uint128{ subtract ? 1u : 0u };
+		}
+	}
+
+	constexpr uint128 barrett_context<uint128>::modulus() const noexcept
+	{
+		return m_modulus;
+	}
+
+	constexpr uint128 barrett_context<uint128>::reduce(u128_wide_product value) const noexcept
+	{
+		assert(value.high < m_modulus);
+		//quotient = floor(value * reciprocal / 2^256), which is floor(value / modulus) or one less.
+		//value / modulus < 2^128, so only the low 128 bits of the quotient are needed, i.e. the
+		//high product's low half and the carries into it out of the middle partial products
+		const uint128 low_product_high = mulhi(value.low, m_reciprocal.low);
+		const u128_wide_product cross_1 = wide_multiply(value.high, m_reciprocal.low);
+		const u128_wide_product cross_2 = wide_multiply(value.low, m_reciprocal.high);
+		const uint128 middle = low_product_high + cross_1.low;
+		const uint128 middle_sum = middle + cross_2.low;
+		const uint128 carries = uint128{ middle < low_product_high ? 1u : 0u } + uint128{ middle_sum < middle ? 1u : 0u };
+		const uint128 quotient = value.high * m_reciprocal.high + cross_1.high + cross_2.high + carries;
+
+		//the remainder is less than 2 * modulus, which may not fit in 128 bits
+		const u128_wide_product subtrahend = wide_multiply(quotient, m_modulus);
+		const uint128 remainder = value.low - subtrahend.low;
+		const uint128 remainder_high = value.high - subtrahend.high - uint128{ value.low < subtrahend.low ? 1u : 0u };
+		return (remainder_high != 0 || remainder >= m_modulus) ? remainder - m_modulus : remainder;
+	}
+
+	constexpr uint128 barrett_context<uint128>::reduce(uint128 value) const noexcept
+	{
+		return reduce(u128_wide_product{ 0, value });
+	}
+
+	constexpr uint128 barrett_context<uint128>::mul(uint128 lhs, uint128 rhs) const noexcept
+	{
+		assert(lhs < m_modulus && rhs < m_modulus);
+		return reduce(wide_multiply(lhs, rhs));
+	}
+
+	constexpr uint128 barrett_context<uint128>::sqr(uint128 value) const noexcept
+	{
+		return mul(value, value);
+	}
+
+	constexpr uint128 barrett_context<uint128>::add(uint128 lhs, uint128 rhs) const noexcept
+	{
+		return internal::add_mod(lhs, rhs, m_modulus);
+	}
+
+	constexpr uint128 barrett_context<uint128>::sub(uint128 lhs, uint128 rhs) const noexcept
+	{
+		return internal::sub_mod(lhs, rhs, m_modulus);
+	}
+
+	constexpr uint128 barrett_context<uint128>::pow(uint128 base, uint128 exponent) const noexcept
+	{
+		assert(base < m_modulus);
+		uint128 result = 1;
+		for (; exponent != 0; exponent >>= 1)
+		{
+			if ((exponent & 1) != 0)
+			{
+				result = mul(result, base);
+			}
+			base = sqr(base);
+		}
+		return result;
+	}
+}
+#endif
@@ -0,0 +1,127 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_NUMBER_THEORY_HPP_
+#define CJM_UINT128_NUMBER_THEORY_HPP_
+#include <cjm/numerics/uint128.hpp>
+#include <cjm/numerics/uint128_modular.hpp>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace cjm::numerics
+{
+	/// <summary>
+	/// Greatest common divisor by the binary (Stein) algorithm, which needs only shifts and subtractions.
+	/// gcd(0, 0) is 0.
+	/// </summary>
+	[[nodiscard]] constexpr uint128 gcd(uint128 first, uint128 second) noexcept;
+
+	/// <summary>
+	/// Least common multiple; lcm(x, 0) is 0.  If the true result does not fit in 128 bits,
+	/// it is reduced modulo 2^128.
+	/// </summary>
+	[[nodiscard]] constexpr uint128 lcm(uint128 first, uint128 second) noexcept;
+
+	/// <summary>
+	/// The x in [0, modulus) with value * x = 1 (mod modulus), by the extended Euclidean algorithm.
+	/// </summary>
+	/// <returns>std::nullopt if modulus is zero or value and modulus are not coprime.</returns>
+	[[nodiscard]] constexpr std::optional<uint128> mod_inverse(uint128 value, uint128 modulus) noexcept;
+
+	/// <summary>
+	/// base^exponent mod modulus, using a montgomery_context for odd moduli and a barrett_context
+	/// otherwise.  To raise many bases to powers of the same modulus, make the context once instead.
+	/// </summary>
+	/// <exception cref="std::domain_error">modulus is zero.</exception>
+	[[nodiscard]] constexpr uint128 pow_mod(uint128 base, uint128 exponent, uint128 modulus);
+
+	/// <summary>
+	/// Deterministic primality test.  After trial division by the primes through 47:
+	///		below 3'317'044'064'679'887'385'961'981 (about 2^81), strong probable prime tests to the
+	///		prime bases 2 through 41, which are proven to admit no strong pseudoprime in that range;
+	///		above it, the Baillie-PSW test (a base 2 strong probable prime test followed by a strong
+	///		Lucas probable prime test), which has no known pseudoprime.
+	/// All arithmetic is done in Montgomery form, so this is usable in constant expressions.
+	/// </summary>
+	[[nodiscard]] constexpr bool is_prime(uint128 value) noexcept;
+
+	namespace internal
+	{
+		/// <summary>
+		/// floor(sqrt(value)) by Newton's iteration from above.
+		/// </summary>
+		constexpr uint128 isqrt(uint128 value) noexcept;
+
+		/// <summary>
+		/// The Jacobi symbol (value / modulus) for odd modulus: -1, 0 or 1.
+		/// </summary>
+		constexpr int jacobi_symbol(uint128 value, uint128 modulus) noexcept;
+
+		/// <summary>
+		/// Strong probable prime (Miller-Rabin) test of context.modulus() to base, which must be
+		/// less than the modulus.
+		/// </summary>
+		constexpr bool is_strong_probable_prime(const montgomery_context<uint128>& context, uint128 base) noexcept;
+
+		/// <summary>
+		/// Strong Lucas probable prime test of context.modulus() with Selfridge's parameters
+		/// (P = 1, Q = (1 - D) / 4, D the first of 5, -7, 9, -11 ... with Jacobi symbol -1).
+		/// The modulus must have no prime factor below 50.
+		/// </summary>
+		constexpr bool is_strong_lucas_probable_prime(const montgomery_context<uint128>& context) noexcept;
+
+		/// <summary>
+		/// The primes through 47, tried before any probable prime test; 2 through 41 are also
+		/// the Miller-Rabin bases.
+		/// </summary>
+		constexpr std::array<std::uint64_t, 15> trial_division_primes = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47 };
+
+		/// <summary>
+		/// 3 * 5 * ... * 47: one 128-bit remainder by this leaves only 64-bit remainders
+		/// for trial division.
+		/// </summary>
+		constexpr std::uint64_t odd_trial_primes_product = 307'444'891'294'245'705;
+
+		/// <summary>
+		/// The smallest strong pseudoprime to all of the first i + 1 prime bases
+		/// (Jaeschke; Sorenson and Webster).  A value below entry i that passes those bases is prime.
+		/// </summary>
+		constexpr std::array<uint128, 13> strong_pseudoprime_bounds =
+		{
+			2'047,
+			1'373'653,
+			25'326'001,
+			3'215'031'751,
+			2'152'302'898'747,
+			3'474'749'660'383,
+			341'550'071'728'321,
+			341'550'071'728'321,
+			3'825'123'056'546'413'051,
+			3'825'123'056'546'413'051,
+			3'825'123'056'546'413'051,
+			uint128::make_uint128(0x437A, 0xE928'17F9'FC85'B7E5), //318'665'857'834'031'151'167'461
+			uint128::make_uint128(0x2'BE69, 0x51AD'C5B2'2410'A5FD), //3'317'044'064'679'887'385'961'981
+		};
+	}
+}
+#include <cjm/numerics/uint128_number_theory.inl>
+#endif
@@ -0,0 +1,310 @@
+// Copyright © 2020-2021 CJM Screws, LLC
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// CJM Screws, LLC is a Maryland Limited Liability Company.
+// No copyright claimed to unmodified original work of others.
+// The original, unmodified work of others, to the extent included in this library,
+// is licensed to you under the same terms under which it was licensed to CJM Screws, LLC.
+// For information about copyright and licensing of the original work of others,
+// see Notices file in cjm/ folder.
+#ifndef CJM_UINT128_NUMBER_THEORY_INL_
+#define CJM_UINT128_NUMBER_THEORY_INL_
+#include <cjm/numerics/uint128_number_theory.hpp>
+
+namespace cjm::numerics
+{
+	constexpr uint128 gcd(uint128 first, uint128 second) noexcept
+	{
+		if (first == 0)
+		{
+			return second;
+		}
+		if (second == 0)
+		{
+			return first;
+		}
+		const int common_twos = countr_zero(first | second);
+		first >>= countr_zero(first);
+		//first is odd from here on; subtracting it from odd second leaves an even number or zero
+		do
+		{
+			second >>= countr_zero(second);
+			if (first > second)
+			{
+				std::swap(first, second);
+			}
+			second -= first;
+		} while (second != 0);
+		return first << common_twos;
+	}
+
+	constexpr uint128 lcm(uint128 first, uint128 second) noexcept
+	{
+		if (first == 0 || second == 0)
+		{
+			return 0;
+		}
+		return first / gcd(first, second) * second;
+	}
+
+	constexpr std::optional<uint128> mod_inverse(uint128 value, uint128 modulus) noexcept
+	{
+		if (modulus == 0)
+		{
+			return std::nullopt;
+		}
+		if (modulus == 1)
+		{
+			return uint128{ 0 };
+		}
+		//the Bezout coefficients of value alternate in sign and grow in magnitude, so only their
+		//magnitudes are kept (none exceeds modulus) and the sign follows from the step count
+		uint128 remainder = modulus;
+		uint128 next_remainder = value % modulus;
+		uint128 coefficient = 0;
+		uint128 next_coefficient = 1;
+		bool negative = true;
+		while (next_remainder != 0)
+		{
+			const uint128 quotient = remainder / next_remainder;
+			const uint128 reduced = remainder - quotient * next_remainder;
+			remainder = next_remainder;
+			next_remainder = reduced;
+			const uint128 grown = coefficient + quotient * next_coefficient;
+			coefficient = next_coefficient;
+			next_coefficient = grown;
+			negative = !negative;
+		}
+		if (remainder != 1)
+		{
+			return std::nullopt;
+		}
+		return negative ? modulus - coefficient : coefficient;
+	}
+
+	constexpr uint128 pow_mod(uint128 base, uint128 exponent, uint128 modulus)
+	{
+		if (modulus == 0)
+		{
+			throw std::domain_error{ "Modulus by zero is illegal." };
+		}
+		if (modulus == 1)
+		{
+			return 0;
+		}
+		if ((modulus & 1) != 0)
+		{
+			const auto context = montgomery_context<uint128>{ modulus };
+			return context.from_mont(context.pow(context.to_mont(base), exponent));
+		}
+		const auto context = barrett_context<uint128>{ modulus };
+		return context.pow(context.reduce(base), exponent);
+	}
+
+	constexpr bool is_prime(uint128 value) noexcept
+	{
+		if (value < 2)
+		{
+			return false;
+		}
+		if ((value & 1) == 0)
+		{
+			return value == 2;
+		}
+		const std::uint64_t residue = (value % internal::odd_trial_primes_product).low_part();
+		for (std::uint64_t prime : internal::trial_division_primes)
+		{
+			if (prime != 2 && residue % prime == 0)
+			{
+				return value == prime;
+			}
+		}
+		//no prime factor through 47, so composites start at 53 * 53
+		if (value < 53 * 53)
+		{
+			return true;
+		}
+
+		const auto context = montgomery_context<uint128>{ value };
+		if (value < internal::strong_pseudoprime_bounds.back())
+		{
+			for (size_t i = 0; i < internal::strong_pseudoprime_bounds.size(); ++i)
+			{
+				if (!internal::is_strong_probable_prime(context, internal::trial_division_primes[i]))
+				{
+					return false;
+				}
+				if (value < internal::strong_pseudoprime_bounds[i])
+				{
+					return true;
+				}
+			}
+			return true;
+		}
+		return internal::is_strong_probable_prime(context, 2) && internal::is_strong_lucas_probable_prime(context);
+	}
+
+	namespace internal
+	{
+		constexpr uint128 isqrt(uint128 value) noexcept
+		{
+			if (value < 2)
+			{
+				return value;
+			}
+			//start at a power of two no smaller than the root: the iterates then fall monotonically to it
+			const int bits = std::numeric_limits<uint128>::digits - countl_zero(value);
+			uint128 root = uint128{ 1 } << ((bits + 1) / 2);
+			for (;;)
+			{
+				const uint128 next = (root + value / root) >> 1;
+				if (next >= root)
+				{
+					return root;
+				}
+				root = next;
+			}
+		}
+
+		constexpr int jacobi_symbol(uint128 value, uint128 modulus) noexcept
+		{
+			assert((modulus & 1) != 0);
+			value %= modulus;
+			int result = 1;
+			while (value != 0)
+			{
+				//(2 / modulus) is -1 exactly when modulus is 3 or 5 mod 8
+				const int twos = countr_zero(value);
+				value >>= twos;
+				const auto modulus_mod_8 = modulus.low_part() & 7;
+				if ((twos & 1) != 0 && (modulus_mod_8 == 3 || modulus_mod_8 == 5))
+				{
+					result = -result;
+				}
+				//quadratic reciprocity
+				std::swap(value, modulus);
+				if ((value.low_part() & 3) == 3 && (modulus.low_part() & 3) == 3)
+				{
+					result = -result;
+				}
+				value %= modulus;
+			}
+			return modulus == 1 ? result : 0;
+		}
+
+		constexpr bool is_strong_probable_prime(const montgomery_context<uint128>& context, uint128 base) noexcept
+		{
+			const uint128 modulus = context.modulus();
+			assert(base < modulus);
+			const uint128 modulus_less_one = modulus - 1;
+			const int twos = countr_zero(modulus_less_one);
+			const uint128 one = context.one();
+			const uint128 minus_one = context.sub(0, one);
+			uint128 power = context.pow(context.to_mont(base), modulus_less_one >> twos);
+			if (power == one || power == minus_one)
+			{
+				return true;
+			}
+			for (int i = 1; i < twos; ++i)
+			{
+				power = context.sqr(power);
+				if (power == minus_one)
+				{
+					return true;
+				}
+				if (power == one)
+				{
+					return false;
+				}
+			}
+			return false;
+		}
+
+		constexpr bool is_strong_lucas_probable_prime(const montgomery_context<uint128>& context) noexcept
+		{
+			const uint128 modulus = context.modulus();
+			assert(modulus > 47 * 47 && modulus != std::numeric_limits<uint128>::max());
+			//no D with Jacobi symbol -1 exists for a square
+			const uint128 root = isqrt(modulus);
+			if (root * root == modulus)
+			{
+				return false;
+			}
+			auto to_residue = [modulus](std::int64_t signed_value) -> uint128
+			{
+				return signed_value >= 0 ? uint128{ static_cast<std::uint64_t>(signed_value) }
+					: modulus - static_cast<std::uint64_t>(-signed_value);
+			};
+			std::int64_t discriminant = 5;
+			for (;;)
+			{
+				const int symbol = jacobi_symbol(to_residue(discriminant), modulus);
+				if (symbol == -1)
+				{
+					break;
+				}
+				//modulus has no factor below 50 and |discriminant| stays far below modulus,
+				//so a zero symbol means a proper common factor
+				if (symbol == 0)
+				{
+					return false;
+				}
+				discriminant = discriminant > 0 ? -(discriminant + 2) : -discriminant + 2;
+			}
+			const uint128 d = context.to_mont(to_residue(discriminant));
+			const uint128 q = context.to_mont(to_residue((1 - discriminant) / 4));
+
+			//(x / 2) mod modulus; halving commutes with the Montgomery factor
+			auto halve = [modulus](uint128 x) -> uint128
+			{
+				return (x & 1) == 0 ? x >> 1 : (x >> 1) + (modulus >> 1) + 1;
+			};
+
+			//U_k, V_k and Q^k for k running over the prefixes of the odd part of modulus + 1, with P = 1:
+			//	U_2k = U_k V_k,	V_2k = V_k^2 - 2 Q^k,	U_k+1 = (U_k + V_k) / 2,	V_k+1 = (D U_k + V_k) / 2
+			const uint128 modulus_plus_one = modulus + 1;
+			const int twos = countr_zero(modulus_plus_one);
+			const uint128 odd_part = modulus_plus_one >> twos;
+			uint128 u = context.one();
+			uint128 v = context.one();
+			uint128 q_power = q;
+			for (int bit = std::numeric_limits<uint128>::digits - 2 - countl_zero(odd_part); bit >= 0; --bit)
+			{
+				u = context.mul(u, v);
+				v = context.sub(context.sqr(v), context.add(q_power, q_power));
+				q_power = context.sqr(q_power);
+				if (((odd_part >> bit) & 1) != 0)
+				{
+					const uint128 next_u = halve(context.add(u, v));
+					v = halve(context.add(context.mul(d, u), v));
+					u = next_u;
+					q_power = context.mul(q_power, q);
+				}
+			}
+			if (u == 0 || v == 0)
+			{
+				return true;
+			}
+			for (int i = 1; i < twos; ++i)
+			{
+				v = context.sub(context.sqr(v), context.add(q_power, q_power));
+				if (v == 0)
+				{
+					return true;
+				}
+				q_power = context.sqr(q_power);
+			}
+			return false;
+		}
+	}
+}
+#endif
@@ -912,6 +912,22 @@ void cjm::uint128_tests::print_environ_data([[maybe_unused]] std::basic_ostream<
 	{
 		cout << "SSE3: [NOT AVAILABLE]." << newl;
 	}
+	if constexpr (numerics::ssse3_available)
+	{
+		cout << "SSSE3: [AVAILABLE]." << newl;
+	}
+	else
+	{
+		cout << "SSSE3: [NOT AVAILABLE]." << newl;
+	}
+	if constexpr (numerics::avx2_available)
+	{
+		cout << "AVX2: [AVAILABLE]." << newl;
+	}
+	else
+	{
+		cout << "AVX2: [NOT AVAILABLE]." << newl;
+	}
 	if constexpr (numerics::intel_adx_available)
 	{
 		cout << "Intel ADX: [AVAILABLE]." << newl;
@@ -1095,6 +1111,31 @@ void cjm::uint128_tests::execute_uint128_tests()
 
 	execute_test(execute_umult_spec_tests, "umult_spec_tests"sv);
 	execute_test(execute_uintcontainer_adc_tests, "uintcontainer_adc_tests"sv);
+	execute_test(execute_to_chars_from_chars_test, "to_chars_from_chars_test"sv);
+	execute_test(execute_decimal_formatting_test, "decimal_formatting_test"sv);
+	execute_test(execute_hex_formatting_parsing_test, "hex_formatting_parsing_test"sv);
+	execute_test(execute_decimal_parsing_test, "decimal_parsing_test"sv);
+	execute_test(execute_try_parse_test, "try_parse_test"sv);
+	execute_test(execute_format_spec_test, "format_spec_test"sv);
+	execute_test(execute_format_decimal_test, "format_decimal_test"sv);
+	execute_test(execute_stream_extraction_test, "stream_extraction_test"sv);
+	execute_test(execute_radix_conversion_test, "radix_conversion_test"sv);
+	execute_test(execute_limb_division_test, "limb_division_test"sv);
+	execute_test(execute_divider_test, "divider_test"sv);
+	execute_test(execute_div_by_test, "div_by_test"sv);
+	execute_test(execute_batch_div_mod_test, "batch_div_mod_test"sv);
+	execute_test(execute_div_mod_u64_test, "div_mod_u64_test"sv);
+	execute_test(execute_wide_multiply_test, "wide_multiply_test"sv);
+	execute_test(execute_fixed_uint_test, "fixed_uint_test"sv);
+	execute_test(execute_int128_test, "int128_test"sv);
+	execute_test(execute_multi_limb_dispatch_test, "multi_limb_dispatch_test"sv);
+	execute_test(execute_atomic_uint128_test, "atomic_uint128_test"sv);
+	execute_test(execute_uint128_column_test, "uint128_column_test"sv);
+	execute_test(execute_uint128_hash_test, "uint128_hash_test"sv);
+	execute_test(execute_uint128_flat_map_test, "uint128_flat_map_test"sv);
+	execute_test(execute_modular_context_test, "modular_context_test"sv);
+	execute_test(execute_number_theory_test, "number_theory_test"sv);
+	execute_test(execute_bit_functions_test, "bit_functions_test"sv);
 
 	{
 		auto cout = guard_ptr->cout_proxy();
@@ -4801,6 +4842,1743 @@ void cjm::uint128_tests::execute_uintcontainer_adc_tests([[maybe_unused]] std::b
 	
 }
 
+void cjm::uint128_tests::execute_to_chars_from_chars_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr auto ctime_round_trip = []() -> uint128_t
+	{
+		std::array<char, 64> buffer{};
+		auto [end, ec] = cjm::numerics::to_chars(buffer.data(), buffer.data() + buffer.size(), 0xc0de'd00d'fea2'cafe'babe'b00b'600d'f00d_u128);
+		uint128_t ret = 0;
+		if (ec == std::errc{})
+			cjm::numerics::from_chars(buffer.data(), end, ret);
+		return ret;
+	}();
+	static_assert(ctime_round_trip == 0xc0de'd00d'fea2'cafe'babe'b00b'600d'f00d_u128);
+
+	std::array<char, cjm::numerics::internal::u128_max_chars> buffer{};
+	char* const first = buffer.data();
+	char* const last = buffer.data() + buffer.size();
+	auto to_sv = [first](const char* end) -> std::string_view
+	{
+		return std::string_view{ first, static_cast<size_t>(end - first) };
+	};
+
+	auto format = [=](uint128_t value, int base) -> std::optional<std::string_view>
+	{
+		const auto [end, ec] = cjm::numerics::to_chars(first, last, value, base);
+		return ec == std::errc{} ? std::make_optional(to_sv(end)) : std::nullopt;
+	};
+	cjm_assert(format(max_value, 10) == "340282366920938463463374607431768211455"sv);
+	cjm_assert(format(max_value, 16) == "ffffffffffffffffffffffffffffffff"sv);
+	cjm_assert(format(max_value, 36) == "f5lxx1zz5pnorynqglhzmsp33"sv);
+	cjm_assert(format(max_value, 2) == std::string_view{ std::string(128, '1') });
+	cjm_assert(format(0_u128, 10) == "0"sv);
+
+	const auto too_small = cjm::numerics::to_chars(first, first + 38, max_value);
+	cjm_assert(too_small.ec == std::errc::value_too_large && too_small.ptr == first + 38);
+	const auto bad_base = cjm::numerics::to_chars(first, last, max_value, 37);
+	cjm_assert(bad_base.ec == std::errc::invalid_argument);
+
+	uint128_t parsed = 0xd00d_u128;
+	constexpr auto too_big = "340282366920938463463374607431768211456 "sv;
+	const auto overflow = cjm::numerics::from_chars(too_big.data(), too_big.data() + too_big.size(), parsed);
+	cjm_assert(overflow.ec == std::errc::result_out_of_range && overflow.ptr == too_big.data() + 39 && parsed == 0xd00d_u128);
+	constexpr auto no_digits = "xyz"sv;
+	const auto illegal = cjm::numerics::from_chars(no_digits.data(), no_digits.data() + no_digits.size(), parsed);
+	cjm_assert(illegal.ec == std::errc::invalid_argument && illegal.ptr == no_digits.data() && parsed == 0xd00d_u128);
+	constexpr auto mixed_case_hex = "DeadBeef-"sv;
+	const auto partial = cjm::numerics::from_chars(mixed_case_hex.data(), mixed_case_hex.data() + mixed_case_hex.size(), parsed, 16);
+	cjm_assert(partial.ec == std::errc{} && *partial.ptr == '-' && parsed == 0xdead'beef_u128);
+
+	auto gen = generator::rgen{};
+	constexpr size_t num_values = 10'000;
+	for (size_t i = 0; i < num_values; ++i)
+	{
+		const auto value = generator::create_random_in_range<uint128_t>(gen);
+		const auto ctrl = to_ctrl(value);
+		auto dec_strm = string::make_throwing_sstream<char>();
+		auto hex_strm = string::make_throwing_sstream<char>();
+		auto oct_strm = string::make_throwing_sstream<char>();
+		dec_strm << ctrl;
+		hex_strm << std::hex << ctrl;
+		oct_strm << std::oct << ctrl;
+		for (const auto& [base, text] : { std::make_pair(10, dec_strm.str()),
+			std::make_pair(16, hex_strm.str()), std::make_pair(8, oct_strm.str()) })
+		{
+			const auto [end, res] = cjm::numerics::to_chars(first, last, value, base);
+			cjm_assert(res == std::errc{} && to_sv(end) == text);
+		}
+		for (int base = 2; base <= 36; ++base)
+		{
+			const auto [end, res] = cjm::numerics::to_chars(first, last, value, base);
+			cjm_assert(res == std::errc{});
+			uint128_t round_tripped = 0;
+			const auto [parse_end, parse_res] = cjm::numerics::from_chars(first, end, round_tripped, base);
+			cjm_assert(parse_res == std::errc{} && parse_end == end && round_tripped == value);
+		}
+	}
+}
+
+void cjm::uint128_tests::execute_decimal_formatting_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr auto max_text = []() -> std::array<char, std::numeric_limits<uint128_t>::digits10 + 1>
+	{
+		std::array<char, std::numeric_limits<uint128_t>::digits10 + 1> ret{};
+		cjm::numerics::write_decimal_unchecked(ret.data(), std::numeric_limits<uint128_t>::max());
+		return ret;
+	}();
+	static_assert(std::string_view{ max_text.data(), max_text.size() } == "340282366920938463463374607431768211455"sv);
+	static_assert(cjm::numerics::decimal_digit_count(0_u128) == 1);
+	static_assert(cjm::numerics::decimal_digit_count(max_value) == 39);
+	static_assert(cjm::numerics::internal::div_mod_u64_max_pow10(max_value).quotient == max_value / 10'000'000'000'000'000'000_u128);
+
+	auto check = [](uint128_t value) -> void
+	{
+		std::array<char, std::numeric_limits<uint128_t>::digits10 + 1> buffer{};
+		const char* end = cjm::numerics::write_decimal_unchecked(buffer.data(), value);
+		auto ctrl_strm = string::make_throwing_sstream<char>();
+		ctrl_strm << to_ctrl(value);
+		cjm_assert(std::string_view{ buffer.data(), static_cast<size_t>(end - buffer.data()) } == ctrl_strm.str());
+		cjm_assert(static_cast<size_t>(cjm::numerics::decimal_digit_count(value)) == ctrl_strm.str().size());
+		const auto [quotient, remainder] = cjm::numerics::internal::div_mod_u64_max_pow10(value);
+		cjm_assert(quotient == value / 10'000'000'000'000'000'000_u128 && remainder == value % 10'000'000'000'000'000'000_u128);
+	};
+
+	uint128_t power = 1;
+	for (int i = 0; i <= std::numeric_limits<uint128_t>::digits10; ++i, power *= 10)
+	{
+		check(power - 1);
+		check(power);
+		check(power + 1);
+	}
+	for (int i = 0; i < std::numeric_limits<uint128_t>::digits; ++i)
+	{
+		check(1_u128 << i);
+		check((1_u128 << i) - 1);
+	}
+	check(max_value);
+
+	auto gen = generator::rgen{};
+	for (size_t i = 0; i < 2'500; ++i)
+	{
+		check(generator::create_random_in_range<uint128_t>(gen));
+	}
+}
+
+void cjm::uint128_tests::execute_hex_formatting_parsing_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr auto sample = 0xc0de'd00d'fea2'cafe'babe'b00b'600d'f00d_u128;
+	constexpr auto ctime_fixed = []() -> std::array<char, 32>
+	{
+		std::array<char, 32> ret{};
+		cjm::numerics::write_hex_fixed_unchecked(ret.data(), 0xc0de'd00d'fea2'cafe'babe'b00b'600d'f00d_u128, true);
+		return ret;
+	}();
+	static_assert(std::string_view{ ctime_fixed.data(), ctime_fixed.size() } == "C0DED00DFEA2CAFEBABEB00B600DF00D"sv);
+	constexpr auto ctime_parsed = []() -> uint128_t
+	{
+		constexpr auto text = "c0deD00Dfea2cafe"sv;
+		uint128_t ret = 0;
+		cjm::numerics::from_hex_chars(text.data(), text.data() + text.size(), ret);
+		return ret;
+	}();
+	static_assert(ctime_parsed == 0xc0de'd00d'fea2'cafe_u128);
+
+	std::array<char, 64> buffer{};
+	char* const first = buffer.data();
+	auto to_sv = [first](const char* end) -> std::string_view
+	{
+		return std::string_view{ first, static_cast<size_t>(end - first) };
+	};
+	auto parse = [](std::string_view text) -> std::pair<uint128_t, std::from_chars_result>
+	{
+		uint128_t ret = 0xd00d_u128;
+		const auto res = cjm::numerics::from_hex_chars(text.data(), text.data() + text.size(), ret);
+		return std::make_pair(ret, res);
+	};
+
+	cjm_assert(to_sv(cjm::numerics::write_hex_unchecked(first, 0_u128)) == "0"sv);
+	cjm_assert(to_sv(cjm::numerics::write_hex_fixed_unchecked(first, 0_u128)) == std::string_view{ std::string(32, '0') });
+	cjm_assert(to_sv(cjm::numerics::write_hex_unchecked(first, max_value, true)) == std::string_view{ std::string(32, 'F') });
+	cjm_assert(to_sv(cjm::numerics::write_hex_unchecked(first, sample)) == "c0ded00dfea2cafebabeb00b600df00d"sv);
+
+	//every prefix length, with and without a trailing non-digit
+	const std::string all_digits = "0123456789abcdefABCDEF0123456789";
+	for (size_t length = 0; length <= all_digits.size(); ++length)
+	{
+		const std::string digits = all_digits.substr(0, length);
+		const uint128_t expected = length == 0 ? 0xd00d_u128 : uint128_t::make_from_string<char>("0x" + digits);
+		for (const std::string& text : { digits, digits + "g", digits + "-0123456789abcdef0123456789abcdef" })
+		{
+			const auto [value, res] = parse(text);
+			if (length == 0)
+			{
+				cjm_assert(res.ec == std::errc::invalid_argument && res.ptr == text.data() && value == 0xd00d_u128);
+			}
+			else
+			{
+				cjm_assert(res.ec == std::errc{} && res.ptr == text.data() + length && value == expected);
+			}
+		}
+	}
+	//more than 32 digits is fine only if the excess are leading zeros
+	const std::string padded = std::string(7, '0') + "c0ded00dfea2cafebabeb00b600df00d";
+	const auto [padded_value, padded_res] = parse(padded);
+	cjm_assert(padded_res.ec == std::errc{} && padded_res.ptr == padded.data() + padded.size() && padded_value == sample);
+	const std::string too_long = "1" + std::string(32, '0');
+	const auto [too_long_value, too_long_res] = parse(too_long);
+	cjm_assert(too_long_res.ec == std::errc::result_out_of_range && too_long_value == 0xd00d_u128);
+	cjm_assert_throws<std::invalid_argument>([]() -> void
+	{
+		[[maybe_unused]] const auto bad = uint128_t::make_from_string<char>("0xc0deg00d"sv);
+	});
+
+	auto gen = generator::rgen{};
+	constexpr size_t num_values = 10'000;
+	for (size_t i = 0; i < num_values; ++i)
+	{
+		const auto value = generator::create_random_in_range<uint128_t>(gen);
+		auto hex_strm = string::make_throwing_sstream<char>();
+		auto upper_strm = string::make_throwing_sstream<char>();
+		hex_strm << std::hex << to_ctrl(value);
+		upper_strm << std::hex << std::uppercase << std::setw(32) << std::setfill('0') << to_ctrl(value);
+		const std::string text = hex_strm.str();
+		cjm_assert(to_sv(cjm::numerics::write_hex_unchecked(first, value)) == text);
+		cjm_assert(to_sv(cjm::numerics::write_hex_fixed_unchecked(first, value, true)) == upper_strm.str());
+		const auto [parsed, res] = parse(text);
+		cjm_assert(res.ec == std::errc{} && res.ptr == text.data() + text.size() && parsed == value);
+		const auto [parsed_upper, res_upper] = parse(upper_strm.str());
+		cjm_assert(res_upper.ec == std::errc{} && parsed_upper == value);
+		cjm_assert(uint128_t::make_from_string<char>("0x" + text) == value);
+	}
+}
+
+void cjm::uint128_tests::execute_decimal_parsing_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr auto ctime_parsed = []() -> uint128_t
+	{
+		constexpr auto text = "256368684942083501355085096987188714192"sv;
+		uint128_t ret = 0;
+		cjm::numerics::from_decimal_chars(text.data(), text.data() + text.size(), ret);
+		return ret;
+	}();
+	static_assert(ctime_parsed == 0xc0de'd00d'face'cafe'babe'b00b'fea2'dad0_u128);
+	static_assert(cjm::numerics::internal::parse_eight_decimal_digits(
+		cjm::numerics::internal::load_u64_little_endian("12345678")) == 12'345'678u);
+
+	auto parse = [](std::string_view text) -> std::pair<uint128_t, std::from_chars_result>
+	{
+		uint128_t ret = 0xd00d_u128;
+		const auto res = cjm::numerics::from_decimal_chars(text.data(), text.data() + text.size(), ret);
+		return std::make_pair(ret, res);
+	};
+	auto check_ok = [&](std::string_view text, size_t consumed, uint128_t expected) -> void
+	{
+		const auto [value, res] = parse(text);
+		cjm_assert(res.ec == std::errc{} && res.ptr == text.data() + consumed && value == expected);
+	};
+	auto check_fails = [&](std::string_view text, size_t consumed, std::errc expected) -> void
+	{
+		const auto [value, res] = parse(text);
+		cjm_assert(res.ec == expected && res.ptr == text.data() + consumed && value == 0xd00d_u128);
+	};
+
+	check_ok("340282366920938463463374607431768211455"sv, 39, max_value);
+	check_ok("00000000340282366920938463463374607431768211455,"sv, 47, max_value);
+	check_ok("0"sv, 1, 0);
+	check_ok("0000000000000000000000x"sv, 22, 0);
+	check_fails(""sv, 0, std::errc::invalid_argument);
+	check_fails("-1"sv, 0, std::errc::invalid_argument);
+	check_fails("340282366920938463463374607431768211456"sv, 39, std::errc::result_out_of_range);
+	check_fails("340282366920938463463374607431768211460"sv, 39, std::errc::result_out_of_range);
+	check_fails("3402823669209384634633746074317682114550 "sv, 40, std::errc::result_out_of_range);
+	check_fails("999999999999999999999999999999999999999999999999999999999999a"sv, 60, std::errc::result_out_of_range);
+
+	//every length (so every split between vector, swar and scalar conversion), with and without a terminator
+	std::string digits;
+	uint128_t expected = 0;
+	for (size_t length = 1; length <= std::numeric_limits<uint128_t>::digits10; ++length)
+	{
+		const char next = static_cast<char>('1' + (length * 7) % 9);
+		digits.push_back(next);
+		expected = expected * 10 + static_cast<unsigned>(next - '0');
+		check_ok(digits, length, expected);
+		check_ok(digits + "/", length, expected);
+		check_ok(digits + ":0123456789012345678901234567890123456789", length, expected);
+	}
+
+	cjm_assert(uint128_t::make_from_string("340282366920938463463374607431768211455"sv) == max_value);
+	cjm_assert(uint128_t::make_from_string(u"340282366920938463463374607431768211455"sv) == max_value);
+	cjm_assert(uint128_t::make_from_string(" 12,345 "sv) == 12'345);
+	cjm_assert_throws<std::overflow_error>([]() -> void
+	{
+		[[maybe_unused]] const auto bad = uint128_t::make_from_string("340282366920938463463374607431768211456"sv);
+	});
+	cjm_assert_throws<std::overflow_error>([]() -> void
+	{
+		[[maybe_unused]] const auto bad = uint128_t::make_from_string(u"1000000000000000000000000000000000000000000"sv);
+	});
+	cjm_assert_throws<std::invalid_argument>([]() -> void
+	{
+		[[maybe_unused]] const auto bad = uint128_t::make_from_string("1234S678"sv);
+	});
+
+	auto gen = generator::rgen{};
+	for (size_t i = 0; i < 2'500; ++i)
+	{
+		const auto value = generator::create_random_in_range<uint128_t>(gen);
+		auto strm = string::make_throwing_sstream<char>();
+		strm << to_ctrl(value);
+		const auto text = strm.str();
+		check_ok(text, text.size(), value);
+		cjm_assert(uint128_t::make_from_string(text) == value);
+	}
+}
+
+void cjm::uint128_tests::execute_try_parse_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::u128_parse_error;
+	static_assert(*uint128_t::try_make_from_string(" 0xc0de_d00d "sv).value == 0xc0de'd00d_u128);
+	static_assert(uint128_t::try_make_from_string(u"0123"sv).error == u128_parse_error::Illegal);
+
+	auto check = [](const auto& text, std::optional<uint128_t> expected, u128_parse_error expected_error) -> void
+	{
+		const auto result = uint128_t::try_make_from_string(text);
+		cjm_assert(static_cast<bool>(result) == expected.has_value() && result.value == expected && result.error == expected_error);
+		//the throwing version must agree
+		if (expected_error == u128_parse_error::None)
+		{
+			cjm_assert(uint128_t::make_from_string(text) == *expected);
+		}
+		else if (expected_error == u128_parse_error::Overflow)
+		{
+			cjm_assert_throws<std::overflow_error>([&]() -> void
+			{
+				[[maybe_unused]] const auto ignored = uint128_t::make_from_string(text);
+			});
+		}
+		else
+		{
+			cjm_assert_throws<std::invalid_argument>([&]() -> void
+			{
+				[[maybe_unused]] const auto ignored = uint128_t::make_from_string(text);
+			});
+		}
+	};
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr auto none = u128_parse_error::None;
+
+	check("340282366920938463463374607431768211455"sv, max_value, none);
+	check(L"\t340,282,366,920,938,463,463,374,607,431,768,211,455\n"sv, max_value, none);
+	check(u8"0xFFFFFFFF_FFFFFFFF_ffffffff_ffffffff"sv, max_value, none);
+	check(u"  0"sv, 0_u128, none);
+	check(U"000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"sv,
+		0_u128, none);
+	check("12345"s, 12'345_u128, none);
+	check(""sv, std::nullopt, u128_parse_error::Empty);
+	check(u" ,_ "sv, std::nullopt, u128_parse_error::Empty);
+	check("340282366920938463463374607431768211456"sv, std::nullopt, u128_parse_error::Overflow);
+	check(U"3402823669209384634633746074317682114550000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"sv,
+		std::nullopt, u128_parse_error::Overflow);
+	check("12 34"sv, std::nullopt, u128_parse_error::Illegal);
+	check(L"0x"sv, std::nullopt, u128_parse_error::Illegal);
+	check(u8"0x1_0000_0000_0000_0000_0000_0000_0000_0000"sv, std::nullopt, u128_parse_error::Illegal);
+	check("-1"sv, std::nullopt, u128_parse_error::Illegal);
+	check(u"12é34"sv, std::nullopt, u128_parse_error::Illegal);
+	check(U"\U0001F600"sv, std::nullopt, u128_parse_error::Illegal);
+
+	//a malformed token fails the stream without writing anything to std::cerr
+	auto captured = std::stringstream{};
+	auto* const cerr_buffer = std::cerr.rdbuf(captured.rdbuf());
+	auto in = std::stringstream{ "12345 bad 0x10" };
+	uint128_t first = 0;
+	uint128_t second = 0;
+	in >> first;
+	const bool first_ok = static_cast<bool>(in);
+	in >> second;
+	const bool second_failed = in.fail();
+	std::cerr.rdbuf(cerr_buffer);
+	cjm_assert(first_ok && first == 12'345_u128);
+	cjm_assert(second_failed && second == 0);
+	cjm_assert(captured.str().empty());
+	in.clear();
+	in >> second;
+	cjm_assert(in && second == 0x10_u128);
+
+	//every whole-text entry point applies parse_u128_text's rules; from_chars keeps std::from_chars semantics
+	struct entry_case final
+	{
+		std::string_view text;
+		std::optional<uint128_t> expected;
+		u128_parse_error error;
+		uint128_t from_chars_value;
+		std::ptrdiff_t from_chars_length;
+		std::errc from_chars_ec;
+	};
+	const auto overflow_39 = "340282366920938463463374607431768211456"sv;
+	const auto overflow_40 = "1000000000000000000000000000000000000000"sv;
+	const auto max_39 = "340282366920938463463374607431768211455"sv;
+	const entry_case entry_cases[] =
+	{
+		{ "0"sv, 0_u128, none, 0_u128, 1, std::errc{} },
+		{ "00"sv, 0_u128, none, 0_u128, 2, std::errc{} },
+		{ "007"sv, std::nullopt, u128_parse_error::Illegal, 7_u128, 3, std::errc{} },
+		{ "0x"sv, std::nullopt, u128_parse_error::Illegal, 0_u128, 1, std::errc{} },
+		{ "0x0"sv, 0_u128, none, 0_u128, 1, std::errc{} },
+		{ max_39, max_value, none, max_value, 39, std::errc{} },
+		{ overflow_39, std::nullopt, u128_parse_error::Overflow, 0_u128, 39, std::errc::result_out_of_range },
+		{ overflow_40, std::nullopt, u128_parse_error::Overflow, 0_u128, 40, std::errc::result_out_of_range },
+	};
+	for (const auto& [text, expected, error, from_chars_value, from_chars_length, from_chars_ec] : entry_cases)
+	{
+		check(text, expected, error);
+		const auto parsed = cjm::numerics::u128_parsing_helper<char>::try_parse(text);
+		cjm_assert(parsed.value == expected && parsed.error == error);
+
+		auto narrow_in = std::stringstream{ std::string{ text } };
+		auto wide_in = std::wstringstream{ std::wstring{ text.begin(), text.end() } };
+		uint128_t narrow_value = 9;
+		uint128_t wide_value = 9;
+		narrow_in >> narrow_value;
+		wide_in >> wide_value;
+		cjm_assert(static_cast<bool>(narrow_in) == expected.has_value() && narrow_value == expected.value_or(0));
+		cjm_assert(static_cast<bool>(wide_in) == expected.has_value() && wide_value == expected.value_or(0));
+
+		uint128_t chars_value = 0;
+		const auto [ptr, ec] = cjm::numerics::from_chars(text.data(), text.data() + text.size(), chars_value);
+		cjm_assert(ec == from_chars_ec && ptr - text.data() == from_chars_length && chars_value == from_chars_value);
+	}
+}
+
+void cjm::uint128_tests::execute_format_spec_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using namespace cjm::numerics::internal;
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+
+	auto format_with = [](std::string_view spec_text, uint128_t value, size_t dynamic_width = 0) -> std::optional<std::string>
+	{
+		u128_format_spec<char> spec{};
+		const char* const end = parse_u128_format_spec(spec_text.data(), spec_text.data() + spec_text.size(), spec);
+		if (end == nullptr)
+			return std::nullopt;
+		std::string ret;
+		write_u128_formatted(std::back_inserter(ret), value, spec, spec.width_from_arg ? dynamic_width : spec.width);
+		return ret;
+	};
+
+	cjm_assert(format_with(""sv, max_value) == "340282366920938463463374607431768211455"s);
+	cjm_assert(format_with("}"sv, 0_u128) == "0"s);
+	cjm_assert(format_with("x"sv, 0xc0de'd00d_u128) == "c0ded00d"s);
+	cjm_assert(format_with("#X"sv, 0xc0de'd00d_u128) == "0XC0DED00D"s);
+	cjm_assert(format_with("#b"sv, 5_u128) == "0b101"s);
+	cjm_assert(format_with("#B"sv, 5_u128) == "0B101"s);
+	cjm_assert(format_with("#o"sv, 8_u128) == "010"s);
+	cjm_assert(format_with("#o"sv, 0_u128) == "0"s);
+	cjm_assert(format_with("+d"sv, 42_u128) == "+42"s);
+	cjm_assert(format_with(" "sv, 42_u128) == " 42"s);
+	cjm_assert(format_with("-"sv, 42_u128) == "42"s);
+	cjm_assert(format_with("8"sv, 42_u128) == "      42"s);
+	cjm_assert(format_with("<8"sv, 42_u128) == "42      "s);
+	cjm_assert(format_with("*^9"sv, 42_u128) == "***42****"s);
+	cjm_assert(format_with("+#010x"sv, 0xff_u128) == "+0x00000ff"s);
+	cjm_assert(format_with(">+#010x"sv, 0xff_u128) == "     +0xff"s);
+	cjm_assert(format_with("_<{}"sv, 7_u128, 3) == "7__"s);
+	cjm_assert(format_with("{1}X}"sv, 0xab_u128, 4) == "  AB"s);
+	cjm_assert(format_with("2"sv, 12'345_u128) == "12345"s);
+	cjm_assert(format_with("#b"sv, max_value)->size() == 130);
+	cjm_assert(!format_with(".3"sv, 1_u128).has_value());
+	cjm_assert(!format_with("Ld"sv, 1_u128).has_value());
+	cjm_assert(!format_with("c"sv, 1_u128).has_value());
+	cjm_assert(!format_with("{x}"sv, 1_u128).has_value());
+	cjm_assert(!format_with("99999999999"sv, 1_u128).has_value());
+
+	u128_format_spec<wchar_t> wide_spec{};
+	constexpr auto wide_spec_text = L"·^+12X"sv;
+	cjm_assert(parse_u128_format_spec(wide_spec_text.data(), wide_spec_text.data() + wide_spec_text.size(), wide_spec)
+		== wide_spec_text.data() + wide_spec_text.size());
+	std::wstring wide;
+	write_u128_formatted(std::back_inserter(wide), 0xbeef_u128, wide_spec, wide_spec.width);
+	cjm_assert(wide == L"···+BEEF····"s);
+
+	auto gen = generator::rgen{};
+	for (size_t i = 0; i < 1'000; ++i)
+	{
+		const auto value = generator::create_random_in_range<uint128_t>(gen);
+		auto strm = string::make_throwing_sstream<char>();
+		strm << std::hex << std::setw(38) << std::setfill('0') << to_ctrl(value);
+		cjm_assert(format_with("#040x"sv, value) == "0x" + strm.str());
+	}
+
+#ifdef __cpp_lib_format
+	cjm_assert(std::format("{}", max_value) == "340282366920938463463374607431768211455"s);
+	cjm_assert(std::format("[{:*^+12X}]", 0xbeef_u128) == "[***+BEEF****]"s);
+	cjm_assert(std::format("{:#0{}b}", 5_u128, 8) == "0b000101"s);
+	cjm_assert(std::format(L"{:>6o}", 8_u128) == L"    10"s);
+	cjm_assert_throws<std::format_error>([]() -> void
+	{
+		[[maybe_unused]] const auto bad = std::vformat("{:.2}", std::make_format_args(1_u128));
+	});
+#endif
+}
+
+void cjm::uint128_tests::execute_format_decimal_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	constexpr auto ctime_values = std::array<uint128_t, 3>{ 0_u128, 42_u128, std::numeric_limits<uint128_t>::max() };
+	static_assert(cjm::numerics::formatted_decimal_length(ctime_values, 2) == 1 + 2 + 39 + 2 * 2);
+
+	//reference: per-value stream insertion
+	auto streamed = []<typename Char>(std::span<const uint128_t> values, std::basic_string_view<Char> separator) -> std::basic_string<Char>
+	{
+		auto strm = std::basic_stringstream<Char>{};
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			if (i != 0)
+				strm << separator;
+			strm << values[i];
+		}
+		return strm.str();
+	};
+
+	std::string empty_output = "header\n";
+	cjm::numerics::format_decimal(std::span<const uint128_t>{}, empty_output, ",");
+	cjm_assert(empty_output == "header\n"s);
+
+	std::array<char, 16> small{};
+	const auto too_small = cjm::numerics::format_decimal(ctime_values, small.data(), small.data() + small.size(), ","sv);
+	cjm_assert(too_small.ec == std::errc::value_too_large && too_small.ptr == small.data() + small.size());
+	std::array<char, 64> exact{};
+	const auto fits = cjm::numerics::format_decimal(ctime_values, exact.data(), exact.data() + 46, ", "sv);
+	cjm_assert(fits.ec == std::errc{} && std::string_view{ exact.data(), fits.ptr } == "0, 42, 340282366920938463463374607431768211455"sv);
+
+	constexpr size_t num_values = 200'000;
+	auto gen = generator::rgen{};
+	auto values = std::vector<uint128_t>{};
+	values.reserve(num_values);
+	while (values.size() < num_values)
+	{
+		values.emplace_back(generator::create_random_in_range<uint128_t>(gen));
+		//cover short values too
+		values.emplace_back(values.back() >> (values.size() % 128));
+	}
+	const auto span = std::span<const uint128_t>{ values };
+
+	const std::string expected = streamed(span, ","sv);
+	for (unsigned threads : { 1u, 2u, 3u, 8u })
+	{
+		std::string output = "ids\n";
+		cjm::numerics::format_decimal(span, output, ",", threads);
+		cjm_assert(output.size() == expected.size() + 4 && std::string_view{ output }.substr(4) == expected);
+	}
+	std::wstring wide;
+	cjm::numerics::format_decimal(span.first(1'000), wide, L"\r\n", 4);
+	cjm_assert(wide == streamed(span.first(1'000), L"\r\n"sv));
+	std::u16string utf16;
+	cjm::numerics::format_decimal(span.first(1'000), utf16, u"|");
+	cjm_assert(utf16.size() == cjm::numerics::formatted_decimal_length(span.first(1'000), 1) && utf16.find(u'|') != std::u16string::npos);
+}
+
+void cjm::uint128_tests::execute_stream_extraction_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+
+	auto extract_all = []<typename Char>(std::basic_istream<Char>& is) -> std::vector<uint128_t>
+	{
+		auto ret = std::vector<uint128_t>{};
+		uint128_t value = 0;
+		while (is >> value)
+		{
+			ret.push_back(value);
+		}
+		return ret;
+	};
+
+	{
+		auto in = std::stringstream{ "  \t12345\n0xc0de_D00D\r\n340,282,366,920,938,463,463,374,607,431,768,211,455 0 " };
+		cjm_assert((extract_all(in) == std::vector<uint128_t>{ 12'345_u128, 0xc0de'd00d_u128, max_value, 0_u128 }));
+		cjm_assert(in.eof() && in.fail() && !in.bad());
+	}
+	{
+		//non-ascii characters are classified by the stream's ctype facet
+		struct nbsp_is_space final : std::ctype<wchar_t>
+		{
+		protected:
+			bool do_is(mask m, wchar_t c) const override
+			{
+				return (c == L'\u00a0' && (m & space) != 0) || std::ctype<wchar_t>::do_is(m, c);
+			}
+		};
+		auto in = std::wstringstream{ L"42\u00a0 7\u00a0" };
+		in.imbue(std::locale{ std::locale::classic(), new nbsp_is_space{} });
+		uint128_t value = 0;
+		in >> value;
+		cjm_assert(in && value == 42_u128);
+		in >> value;
+		cjm_assert(in && value == 7_u128);
+	}
+	{
+		auto in = string::make_throwing_sstream<char16_t>();
+		in.exceptions(std::ios_base::goodbit);
+		in << u" 1\t2\n\n0x3 ";
+		cjm_assert((extract_all(in) == std::vector<uint128_t>{ 1_u128, 2_u128, 3_u128 }));
+	}
+	{
+		//the bad token is consumed, the stream fails and the value is zero; nothing follows it until cleared
+		auto in = std::stringstream{ "1 2x 3" };
+		uint128_t value = 0;
+		in >> value >> value;
+		cjm_assert(in.fail() && !in.eof() && value == 0);
+		in.clear();
+		in >> value;
+		cjm_assert(in && value == 3_u128);
+	}
+	{
+		//plain decimal tokens follow parse_u128_text's leading zero rule like everything else
+		auto in = std::stringstream{ "007 00 0" };
+		uint128_t value = 9;
+		in >> value;
+		cjm_assert(in.fail() && value == 0);
+		in.clear();
+		value = 9;
+		cjm_assert((in >> value) && value == 0);
+		value = 9;
+		cjm_assert((in >> value) && value == 0);
+		cjm_assert(!uint128_t::try_make_from_string("007"sv));
+		bool threw = false;
+		try
+		{
+			[[maybe_unused]] const auto bad = uint128_t::make_from_string("007"sv);
+		}
+		catch (const std::invalid_argument&)
+		{
+			threw = true;
+		}
+		cjm_assert(threw);
+	}
+	{
+		//failures go through the stream's exception mask
+		auto throws_on_extract = [](std::string text) -> bool
+		{
+			auto in = std::stringstream{ std::move(text) };
+			in.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+			uint128_t value = 9;
+			try
+			{
+				in >> value;
+			}
+			catch (const std::ios_base::failure&)
+			{
+				return in.fail() && value == 0;
+			}
+			return false;
+		};
+		cjm_assert(throws_on_extract("007"));
+		cjm_assert(throws_on_extract("0x"));
+		cjm_assert(throws_on_extract("12q"));
+		cjm_assert(throws_on_extract("340282366920938463463374607431768211456"));
+		cjm_assert(throws_on_extract("   "));
+		cjm_assert(!throws_on_extract("0xc0de 7"));
+	}
+	{
+		auto in = std::stringstream{ "123456" };
+		uint128_t value = 0;
+		in >> std::setw(3) >> value;
+		cjm_assert(in && value == 123_u128 && in.width() == 0);
+		in >> value;
+		cjm_assert(value == 456_u128 && in.eof());
+	}
+	{
+		auto in = std::stringstream{ " 42" };
+		uint128_t value = 7;
+		in >> std::noskipws >> value;
+		cjm_assert(in.fail() && value == 0);
+	}
+	{
+		//longer than the fixed token buffer
+		const std::string zeros(300, '0');
+		const std::string too_big = "1" + zeros;
+		auto in = std::stringstream{ zeros + " " + too_big + " 5" };
+		uint128_t value = 9;
+		in >> value;
+		cjm_assert(in && value == 0);
+		in >> value;
+		cjm_assert(in.fail() && value == 0);
+		in.clear();
+		in >> value;
+		cjm_assert(in && value == 5_u128);
+	}
+	{
+		auto in = std::stringstream{ "" };
+		uint128_t value = 9;
+		in >> value;
+		cjm_assert(in.fail() && in.eof() && value == 0);
+	}
+
+	constexpr size_t num_values = 2'500;
+	auto gen = generator::rgen{};
+	auto values = std::vector<uint128_t>{};
+	values.reserve(num_values);
+	while (values.size() < num_values)
+	{
+		values.emplace_back(generator::create_random_in_range<uint128_t>(gen));
+	}
+	std::string text;
+	cjm::numerics::format_decimal(values, text, "\n");
+	auto in = std::stringstream{ text };
+	cjm_assert(extract_all(in) == values);
+}
+
+void cjm::uint128_tests::execute_radix_conversion_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	static_assert(0b1010'0101_u128 == 0xa5_u128);
+	static_assert(0B1_u128 == 1_u128);
+	static_assert(0b11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111'11111111_u128 == max_value);
+	static_assert(0b0000'0001'0000000000000000000000000000000000000000000000000000000000000000_u128 == 0x1'0000'0000'0000'0000_u128);
+	constexpr auto ctime_base32 = []() -> uint128_t
+	{
+		constexpr auto text = "7vvvvvvvvvvvvvvvvvvvvvvvvv"sv;
+		uint128_t ret = 0;
+		cjm::numerics::from_chars(text.data(), text.data() + text.size(), ret, 32);
+		return ret;
+	}();
+	static_assert(ctime_base32 == max_value);
+
+	std::array<char, cjm::numerics::internal::u128_max_chars + 2> buffer{};
+	char* const first = buffer.data();
+	char* const last = buffer.data() + buffer.size();
+	auto parse = [](std::string_view text, int base, uint128_t& value) -> std::from_chars_result
+	{
+		return cjm::numerics::from_chars(text.data(), text.data() + text.size(), value, base);
+	};
+
+	//reference: one generic division per digit
+	auto naive_format = [](uint128_t value, int base) -> std::string
+	{
+		std::string ret;
+		do
+		{
+			const auto [quotient, remainder] = uint128_t::unsafe_div_mod(value, static_cast<unsigned>(base));
+			ret.push_back(cjm::numerics::internal::u128_digit_chars[static_cast<size_t>(remainder.low_part())]);
+			value = quotient;
+		} while (value != 0);
+		std::reverse(ret.begin(), ret.end());
+		return ret;
+	};
+
+	//overflow is detected exactly at the boundary for power-of-two and chunked bases alike
+	for (int base = 2; base <= 36; ++base)
+	{
+		const std::string max_text = naive_format(max_value, base);
+		uint128_t parsed = 0;
+		auto result = parse(max_text, base, parsed);
+		cjm_assert(result.ec == std::errc{} && parsed == max_value);
+		const std::string too_big = max_text + "0";
+		parsed = 7;
+		result = parse(too_big, base, parsed);
+		cjm_assert(result.ec == std::errc::result_out_of_range && result.ptr == too_big.data() + too_big.size() && parsed == 7);
+		const std::string padded = std::string(200, '0') + max_text + "!";
+		result = parse(padded, base, parsed);
+		cjm_assert(result.ec == std::errc{} && *result.ptr == '!' && parsed == max_value);
+		result = parse("!"sv, base, parsed);
+		cjm_assert(result.ec == std::errc::invalid_argument && *result.ptr == '!');
+	}
+	uint128_t parsed = 0;
+	cjm_assert(parse("1" + std::string(127, '0'), 2, parsed).ec == std::errc{} && parsed == (1_u128 << 127));
+	cjm_assert(parse("1" + std::string(128, '0'), 2, parsed).ec == std::errc::result_out_of_range);
+	cjm_assert(parse("3" + std::string(63, '0'), 4, parsed).ec == std::errc{} && parsed == (3_u128 << 126));
+	cjm_assert(parse("4" + std::string(42, '0'), 8, parsed).ec == std::errc::result_out_of_range);
+	cjm_assert(parse("1012z", 2, parsed).ec == std::errc{} && parsed == 5_u128);
+	cjm_assert(parse("zz.", 36, parsed).ec == std::errc{} && parsed == 1'295_u128);
+
+	auto gen = generator::rgen{};
+	constexpr size_t num_values = 20'000;
+	auto values = std::vector<uint128_t>{};
+	values.reserve(num_values);
+	while (values.size() < num_values)
+	{
+		values.emplace_back(generator::create_random_in_range<uint128_t>(gen));
+		values.emplace_back(values.back() >> (values.size() % 128));
+	}
+	for (const uint128_t value : values)
+	{
+		for (int base = 2; base <= 36; ++base)
+		{
+			const auto [end, ec] = cjm::numerics::to_chars(first, last, value, base);
+			cjm_assert(ec == std::errc{} && std::string_view{ first, end } == naive_format(value, base));
+		}
+	}
+}
+
+void cjm::uint128_tests::execute_limb_division_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::internal::div_mod_2by1;
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr std::uint64_t max_limb = std::numeric_limits<std::uint64_t>::max();
+
+	//constant evaluation always takes the limb-based path, whatever the calculation mode
+	constexpr auto ctime_cases = std::array<std::pair<uint128_t, uint128_t>, 12>{
+		std::make_pair(max_value, 1_u128),
+		std::make_pair(max_value, max_value),
+		std::make_pair(max_value - 1, max_value),
+		std::make_pair(max_value, 0x1'0000'0000'0000'0000_u128),
+		std::make_pair(max_value, 0x8000'0000'0000'0000'0000'0000'0000'0001_u128),
+		std::make_pair(0xffff'ffff'ffff'fffe'0000'0000'0000'0001_u128, 0xffff'ffff'ffff'ffff_u128),
+		std::make_pair(0x7fff'ffff'ffff'ffff'8000'0000'0000'0000_u128, 0x8000'0000'0000'0000'ffff'ffff'ffff'ffff_u128),
+		std::make_pair(0xc0de'd00d'fea2'cafe'babe'b00b'600d'f00d_u128, 0x1'0000'0000'0000'0001_u128),
+		std::make_pair(0xc0de'd00d'fea2'cafe'babe'b00b'600d'f00d_u128, 0xdead'beef_u128),
+		std::make_pair(0xc0de'd00d'fea2'cafe'babe'b00b'600d'f00d_u128, 0x3'0000'0001'ffff'ffff'0000'0000_u128),
+		std::make_pair(10'000'000'000'000'000'000_u128, 3_u128),
+		std::make_pair(1_u128, 0xffff'ffff'ffff'ffff'ffff'ffff_u128),
+	};
+	constexpr auto ctime_results = [=]() -> std::array<uint128_t::divmod_result_t, ctime_cases.size()>
+	{
+		std::array<uint128_t::divmod_result_t, ctime_cases.size()> ret{};
+		for (size_t i = 0; i < ctime_cases.size(); ++i)
+		{
+			ret[i] = uint128_t::unsafe_div_mod(ctime_cases[i].first, ctime_cases[i].second);
+		}
+		return ret;
+	}();
+	static_assert(ctime_results[1].quotient == 1 && ctime_results[1].remainder == 0);
+	static_assert(ctime_results[2].quotient == 0 && ctime_results[2].remainder == max_value - 1);
+	for (size_t i = 0; i < ctime_cases.size(); ++i)
+	{
+		const auto [dividend, divisor] = ctime_cases[i];
+		cjm_assert(to_test(to_ctrl(dividend) / to_ctrl(divisor)) == ctime_results[i].quotient);
+		cjm_assert(to_test(to_ctrl(dividend) % to_ctrl(divisor)) == ctime_results[i].remainder);
+	}
+
+	static_assert(div_mod_2by1(max_limb - 1, max_limb, max_limb).quotient == max_limb);
+	static_assert(div_mod_2by1(max_limb - 1, max_limb, max_limb).remainder == max_limb - 1);
+	static_assert(div_mod_2by1(0, 7, 1).quotient == 7 && div_mod_2by1(0, 7, 1).remainder == 0);
+
+	auto gen = generator::rgen{};
+	constexpr size_t num_values = 200'000;
+	for (size_t i = 0; i < num_values; ++i)
+	{
+		const auto random = generator::create_random_in_range<uint128_t>(gen);
+		//vary the divisor's magnitude so every normalization shift comes up
+		const std::uint64_t divisor = std::max<std::uint64_t>(random.low_part() >> (i % 64), 1);
+		const std::uint64_t high = random.high_part() % divisor;
+		const auto [quotient, remainder] = div_mod_2by1(high, random.low_part(), divisor);
+		const auto dividend = uint128_t::make_uint128(high, random.low_part());
+		cjm_assert(quotient == dividend / divisor && remainder == dividend % divisor);
+	}
+}
+
+void cjm::uint128_tests::execute_divider_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::uint128_divider;
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr auto ctime_divider = uint128_divider{ 0xc0de'd00d'fea2'cafe'babe_u128 };
+	static_assert(max_value / ctime_divider == max_value / 0xc0de'd00d'fea2'cafe'babe_u128);
+	static_assert(max_value % ctime_divider == max_value % 0xc0de'd00d'fea2'cafe'babe_u128);
+	static_assert(uint128_divider{ 1_u128 }.div_mod(max_value).quotient == max_value);
+	static_assert(!uint128_divider::try_make(0_u128).has_value());
+	cjm_assert_throws<std::domain_error>([]() { [[maybe_unused]] const auto divider = uint128_divider{ 0_u128 }; });
+
+	auto gen = generator::rgen{};
+	auto divisors = std::vector<uint128_t>{ 1_u128, 2_u128, 3_u128, 7_u128, 10_u128, 1'000_u128,
+		max_value, max_value - 1, (max_value >> 1) + 1, (max_value >> 1) + 2, 0x1'0000'0000'0000'0000_u128,
+		0x1'0000'0000'0000'0001_u128, 0xffff'ffff'ffff'ffff_u128 };
+	for (int shift = 0; shift < std::numeric_limits<uint128_t>::digits; ++shift)
+	{
+		divisors.emplace_back(generator::create_random_in_range<uint128_t>(gen) >> shift);
+	}
+	std::erase(divisors, 0_u128);
+	for (const uint128_t divisor : divisors)
+	{
+		const auto divider = uint128_divider{ divisor };
+		cjm_assert(divider.divisor() == divisor && divider == *uint128_divider::try_make(divisor));
+		for (const uint128_t dividend : { 0_u128, 1_u128, divisor - 1, divisor, divisor + 1, max_value })
+		{
+			cjm_assert(divider.div_mod(dividend) == uint128_t::div_mod(dividend, divisor));
+		}
+		for (size_t i = 0; i < 1'000; ++i)
+		{
+			const auto dividend = generator::create_random_in_range<uint128_t>(gen) >> (i % 128);
+			const auto [quotient, remainder] = divider.div_mod(dividend);
+			cjm_assert(quotient == dividend / divisor && remainder == dividend % divisor);
+			cjm_assert(dividend / divider == quotient && dividend % divider == remainder);
+		}
+	}
+}
+
+void cjm::uint128_tests::execute_div_by_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::div_by;
+	using cjm::numerics::mod_by;
+	using cjm::numerics::div_mod_by;
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr auto max_pow10 = 10'000'000'000'000'000'000_u128;
+	static_assert(div_by<max_pow10>(max_value) == max_value / max_pow10);
+	static_assert(mod_by<max_pow10>(max_value) == max_value % max_pow10);
+	static_assert(div_by<1_u128>(max_value) == max_value && mod_by<1_u128>(max_value) == 0);
+	static_assert(div_mod_by<7_u128>(100_u128) == uint128_t::div_mod(100_u128, 7_u128));
+
+	auto gen = generator::rgen{};
+	auto check_divisor = [&]<uint128_t Divisor>(std::integral_constant<uint128_t, Divisor>) -> void
+	{
+		for (const uint128_t dividend : { 0_u128, 1_u128, Divisor - 1, Divisor, Divisor + 1, max_value })
+		{
+			cjm_assert(div_mod_by<Divisor>(dividend) == uint128_t::div_mod(dividend, Divisor));
+		}
+		for (size_t i = 0; i < 1'000; ++i)
+		{
+			const auto dividend = generator::create_random_in_range<uint128_t>(gen) >> (i % 128);
+			const auto [quotient, remainder] = div_mod_by<Divisor>(dividend);
+			cjm_assert(quotient == dividend / Divisor && remainder == dividend % Divisor);
+			cjm_assert(div_by<Divisor>(dividend) == quotient && mod_by<Divisor>(dividend) == remainder);
+		}
+	};
+	//powers of two, divisors with and without a 128-bit rounded-up reciprocal, one and two limbs
+	check_divisor(std::integral_constant<uint128_t, 1_u128>{});
+	check_divisor(std::integral_constant<uint128_t, 2_u128>{});
+	check_divisor(std::integral_constant<uint128_t, 3_u128>{});
+	check_divisor(std::integral_constant<uint128_t, 7_u128>{});
+	check_divisor(std::integral_constant<uint128_t, 10_u128>{});
+	check_divisor(std::integral_constant<uint128_t, 1'000'000'000'000'000'000_u128>{});
+	check_divisor(std::integral_constant<uint128_t, max_pow10>{});
+	check_divisor(std::integral_constant<uint128_t, 0xffff'ffff'ffff'ffff_u128>{});
+	check_divisor(std::integral_constant<uint128_t, 0x1'0000'0000'0000'0000_u128>{});
+	check_divisor(std::integral_constant<uint128_t, 0x1'0000'0000'0000'0001_u128>{});
+	check_divisor(std::integral_constant<uint128_t, 0xc0de'd00d'fea2'cafe'babe_u128>{});
+	check_divisor(std::integral_constant<uint128_t, (max_value >> 1) + 1>{});
+	check_divisor(std::integral_constant<uint128_t, (max_value >> 1) + 2>{});
+	check_divisor(std::integral_constant<uint128_t, max_value>{});
+}
+
+void cjm::uint128_tests::execute_batch_div_mod_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::uint128_divider;
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	auto gen = generator::rgen{};
+	constexpr size_t num_values = 1'000'000;
+	auto dividends = std::vector<uint128_t>{};
+	auto divisors = std::vector<uint128_t>{};
+	dividends.reserve(num_values);
+	divisors.reserve(num_values);
+	while (dividends.size() < num_values)
+	{
+		const auto shift = static_cast<int>(dividends.size() % 128);
+		dividends.emplace_back(generator::create_random_in_range<uint128_t>(gen) >> (127 - shift));
+		divisors.emplace_back((generator::create_random_in_range<uint128_t>(gen) >> shift) | 1);
+	}
+	auto results = std::vector<uint128_t::divmod_result_t>(num_values);
+
+	for (const uint128_t divisor : { 1_u128, 8_u128, 1'021_u128, 0x1'0000'0000'0000'0001_u128, max_value })
+	{
+		cjm::numerics::div_mod(std::span{ dividends }.first(10'000), divisor, results);
+		for (size_t i = 0; i < 10'000; ++i)
+		{
+			cjm_assert(results[i] == uint128_t::div_mod(dividends[i], divisor));
+		}
+	}
+	cjm::numerics::div_mod(dividends, divisors, results, 4);
+	for (size_t i = 0; i < num_values; ++i)
+	{
+		cjm_assert(results[i] == uint128_t::div_mod(dividends[i], divisors[i]));
+	}
+	const auto empty = std::span<const uint128_t>{};
+	cjm::numerics::div_mod(empty, 3_u128, std::span<uint128_t::divmod_result_t>{}, 4);
+	cjm_assert_throws<std::domain_error>([&]() { cjm::numerics::div_mod(dividends, 0_u128, results); });
+	cjm_assert_throws<std::invalid_argument>([&]() { cjm::numerics::div_mod(dividends, 3_u128, std::span{ results }.first(1)); });
+	cjm_assert_throws<std::invalid_argument>([&]() { cjm::numerics::div_mod(dividends, std::span{ divisors }.first(1), results); });
+	divisors[num_values / 2] = 0;
+	cjm_assert_throws<std::domain_error>([&]() { cjm::numerics::div_mod(dividends, divisors, results); });
+
+	for (uint128_t& dividend : dividends)
+	{
+		dividend = generator::create_random_in_range<uint128_t>(gen);
+	}
+	//a bucket size only known at run time, as a risk engine's would be
+	const auto bucket_size = (generator::create_random_in_range<uint128_t>(gen) >> 118) | 1;
+	auto scalar_results = std::vector<uint128_t::divmod_result_t>(num_values);
+	for (size_t i = 0; i < num_values; ++i)
+	{
+		scalar_results[i] = uint128_t::div_mod(dividends[i], bucket_size);
+	}
+	cjm::numerics::div_mod(dividends, bucket_size, results);
+	const unsigned threads = std::max(2u, std::thread::hardware_concurrency());
+	auto threaded_results = std::vector<uint128_t::divmod_result_t>(num_values);
+	cjm::numerics::div_mod(dividends, bucket_size, threaded_results, threads);
+	for (size_t i = 0; i < num_values; ++i)
+	{
+		cjm_assert(results[i] == scalar_results[i] && results[i] == threaded_results[i]);
+	}
+}
+
+void cjm::uint128_tests::execute_div_mod_u64_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::div_mod_u64;
+	using cjm::numerics::unsafe_div_mod_u64;
+	using narrow_result_t = cjm::numerics::u128_u64_divmod_result;
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	constexpr auto max_u64 = std::numeric_limits<std::uint64_t>::max();
+	static_assert(div_mod_u64(max_value, 10) == narrow_result_t{ max_value / 10, 5 });
+	static_assert(div_mod_u64(max_value, max_u64) == narrow_result_t{ max_value / max_u64, 0 });
+	static_assert(unsafe_div_mod_u64(0xc0de'd00d'fea2'cafe'babe_u128, 1).quotient == 0xc0de'd00d'fea2'cafe'babe_u128);
+	cjm_assert_throws<std::domain_error>([]() { [[maybe_unused]] const auto result = div_mod_u64(1_u128, 0); });
+
+	auto gen = generator::rgen{};
+	auto divisors = std::vector<std::uint64_t>{ 1, 2, 3, 10, max_u64, max_u64 - 1, std::uint64_t{ 1 } << 63, (std::uint64_t{ 1 } << 63) + 1 };
+	for (int shift = 0; shift < std::numeric_limits<std::uint64_t>::digits; ++shift)
+	{
+		divisors.emplace_back(static_cast<std::uint64_t>(generator::create_random_in_range<uint128_t>(gen)) >> shift);
+	}
+	std::erase(divisors, std::uint64_t{ 0 });
+	for (const std::uint64_t divisor : divisors)
+	{
+		for (size_t i = 0; i < 1'000; ++i)
+		{
+			const auto dividend = i == 0 ? max_value : generator::create_random_in_range<uint128_t>(gen) >> (i % 128);
+			const auto [quotient, remainder] = uint128_t::div_mod(dividend, divisor);
+			cjm_assert(div_mod_u64(dividend, divisor) == narrow_result_t{ quotient, static_cast<std::uint64_t>(remainder) });
+			cjm_assert(unsafe_div_mod_u64(dividend, divisor) == div_mod_u64(dividend, divisor));
+		}
+	}
+}
+
+void cjm::uint128_tests::execute_wide_multiply_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::wide_multiply;
+	using cjm::numerics::mulhi;
+	using wide_product_t = cjm::numerics::u128_wide_product;
+	using ctrl_uint256_t = boost::multiprecision::uint256_t;
+	constexpr auto max_value = std::numeric_limits<uint128_t>::max();
+	static_assert(wide_multiply(max_value, max_value) == wide_product_t{ max_value - 1, 1_u128 });
+	static_assert(wide_multiply(max_value, 2_u128) == wide_product_t{ 1_u128, max_value - 1 });
+	static_assert(wide_multiply(1_u128 << 64, 1_u128 << 64) == wide_product_t{ 1_u128, 0_u128 });
+	static_assert(mulhi(max_value, max_value) == max_value - 1 && mulhi(max_value, 1_u128) == 0);
+
+	auto gen = generator::rgen{};
+	for (size_t i = 0; i < 100'000; ++i)
+	{
+		const auto multiplicand = generator::create_random_in_range<uint128_t>(gen) >> (i % 128);
+		const auto multiplier = generator::create_random_in_range<uint128_t>(gen) >> ((i / 128) % 128);
+		const ctrl_uint256_t control = ctrl_uint256_t{ to_ctrl(multiplicand) } * ctrl_uint256_t{ to_ctrl(multiplier) };
+		const auto expected = wide_product_t{ to_test(static_cast<ctrl_uint128_t>(control >> 128)),
+			to_test(static_cast<ctrl_uint128_t>(control & ctrl_uint256_t{ to_ctrl(max_value) })) };
+		cjm_assert(wide_multiply(multiplicand, multiplier) == expected);
+		cjm_assert(mulhi(multiplicand, multiplier) == expected.high && multiplicand * multiplier == expected.low);
+	}
+}
+
+void cjm::uint128_tests::execute_fixed_uint_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::uint256;
+	using cjm::numerics::uint512;
+	using namespace cjm::numerics::fixed_uint_literals;
+	using ctrl_uint256_t = boost::multiprecision::uint256_t;
+	using ctrl_uint512_t = boost::multiprecision::uint512_t;
+
+	static_assert(std::numeric_limits<uint256>::digits == 256 && std::numeric_limits<uint512>::digits == 512);
+	static_assert(std::numeric_limits<uint256>::max() + 1 == 0);
+	static_assert(uint256{ std::numeric_limits<uint128_t>::max() } + 1 == uint256::make_fixed_uint(1_u128, 0_u128));
+	static_assert(uint256::make_fixed_uint(1_u128, 0_u128) - 1 == uint256{ std::numeric_limits<uint128_t>::max() });
+	static_assert(0xffff'ffff'ffff'ffff'ffff'ffff'ffff'ffff_u256 * 0x1'0000'0000'0000'0000'0000'0000'0000'0000_u256 == uint256::make_fixed_uint(std::numeric_limits<uint128_t>::max(), 0_u128));
+	static_assert(uint512{ 1 } << 511 >> 511 == 1);
+
+	auto to_ctrl_256 = [](const uint256& value) -> ctrl_uint256_t
+	{
+		return (ctrl_uint256_t{ to_ctrl(value.high_part()) } << 128) | ctrl_uint256_t{ to_ctrl(value.low_part()) };
+	};
+	auto to_ctrl_512 = [&](const uint512& value) -> ctrl_uint512_t
+	{
+		return (ctrl_uint512_t{ to_ctrl_256(value.high_part()) } << 256) | ctrl_uint512_t{ to_ctrl_256(value.low_part()) };
+	};
+	auto random_256 = [](generator::rgen& gen, int shift) -> uint256
+	{
+		return uint256::make_fixed_uint(generator::create_random_in_range<uint128_t>(gen),
+			generator::create_random_in_range<uint128_t>(gen)) >> shift;
+	};
+
+	auto gen = generator::rgen{};
+	for (size_t i = 0; i < 25'000; ++i)
+	{
+		const auto first = random_256(gen, static_cast<int>(i % 256));
+		auto second = random_256(gen, static_cast<int>((i / 256) % 256));
+		if (second == 0) second = 1;
+		const auto ctrl_first = to_ctrl_256(first);
+		const auto ctrl_second = to_ctrl_256(second);
+		const auto shift = static_cast<int>(i % 256);
+		cjm_assert(to_ctrl_256(first + second) == ctrl_uint256_t{ ctrl_first + ctrl_second });
+		cjm_assert(to_ctrl_256(first - second) == ctrl_uint256_t{ ctrl_first - ctrl_second });
+		cjm_assert(to_ctrl_256(first * second) == ctrl_uint256_t{ ctrl_first * ctrl_second });
+		const auto [quotient, remainder] = uint256::div_mod(first, second);
+		cjm_assert(to_ctrl_256(quotient) == ctrl_uint256_t{ ctrl_first / ctrl_second });
+		cjm_assert(to_ctrl_256(remainder) == ctrl_uint256_t{ ctrl_first % ctrl_second });
+		cjm_assert(to_ctrl_256(first << shift) == ctrl_uint256_t{ ctrl_first << shift });
+		cjm_assert(to_ctrl_256(first >> shift) == ctrl_uint256_t{ ctrl_first >> shift });
+		cjm_assert((first < second) == (ctrl_first < ctrl_second));
+
+		const auto wide_first = uint512::make_fixed_uint(first, second);
+		const auto wide_second = uint512{ second } + 1;
+		const auto ctrl_wide_first = to_ctrl_512(wide_first);
+		const auto ctrl_wide_second = to_ctrl_512(wide_second);
+		cjm_assert(to_ctrl_512(wide_first * wide_second) == ctrl_uint512_t{ ctrl_wide_first * ctrl_wide_second });
+		cjm_assert(to_ctrl_512(wide_first / wide_second) == ctrl_uint512_t{ ctrl_wide_first / ctrl_wide_second });
+		cjm_assert(to_ctrl_512(wide_first % wide_second) == ctrl_uint512_t{ ctrl_wide_first % ctrl_wide_second });
+
+		if (i % 64 == 0)
+		{
+			auto stream = cjm::string::make_throwing_sstream<char>();
+			stream << wide_first;
+			cjm_assert(stream.str() == ctrl_wide_first.str());
+			cjm_assert(uint512::make_from_string(stream.str()) == wide_first);
+		}
+	}
+}
+
+void cjm::uint128_tests::execute_int128_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::int128;
+	using namespace cjm::numerics::int128_literals;
+	using ctrl_int256_t = boost::multiprecision::int256_t;
+	constexpr auto min_value = std::numeric_limits<int128>::min();
+	constexpr auto max_value = std::numeric_limits<int128>::max();
+
+	static_assert(min_value < 0 && max_value > 0 && -min_value == min_value && max_value + 1 == min_value);
+	static_assert(-7_i128 / 2 == -3 && -7_i128 % 2 == -1 && 7_i128 / -2 == -3 && 7_i128 % -2 == 1);
+	static_assert((min_value >> 127) == -1 && (-8_i128 >> 2) == -2 && (max_value >> 126) == 1);
+	static_assert(!cjm::numerics::checked_mul(min_value, -1).has_value() && !cjm::numerics::checked_div(min_value, -1).has_value());
+	static_assert(cjm::numerics::saturating_add(max_value, 1) == max_value && cjm::numerics::saturating_sub(min_value, 1) == min_value);
+	static_assert(cjm::numerics::math_functions::int_abs(min_value) == 1_u128 << 127);
+	static_assert(int128::make_from_string("-170141183460469231731687303715884105728") == min_value);
+
+	const ctrl_int256_t two_64 = ctrl_int256_t{ 1 } << 64;
+	const ctrl_int256_t two_128 = two_64 * two_64;
+	const ctrl_int256_t ctrl_min = -(two_128 / 2);
+	const ctrl_int256_t ctrl_max = two_128 / 2 - 1;
+	auto to_ctrl_i256 = [&](int128 value) -> ctrl_int256_t
+	{
+		return ctrl_int256_t{ value.high_part() } * two_64 + ctrl_int256_t{ value.low_part() };
+	};
+	//the control value modulo 2^128, as int128's wrapping arithmetic produces it
+	auto wrap = [&](ctrl_int256_t value) -> int128
+	{
+		value %= two_128;
+		if (value < 0) value += two_128;
+		return int128::make_int128(static_cast<std::int64_t>((value / two_64).convert_to<std::uint64_t>()),
+			(value % two_64).convert_to<std::uint64_t>());
+	};
+	auto fits = [&](const ctrl_int256_t& value) -> bool { return value >= ctrl_min && value <= ctrl_max; };
+
+	auto gen = generator::rgen{};
+	for (size_t i = 0; i < 50'000; ++i)
+	{
+		auto first = int128{ generator::create_random_in_range<uint128_t>(gen) } >> static_cast<int>(i % 128);
+		auto second = int128{ generator::create_random_in_range<uint128_t>(gen) } >> static_cast<int>((i / 128) % 128);
+		if (i % 101 == 0) first = min_value;
+		if (i % 103 == 0) second = -1;
+		if (second == 0) second = 1;
+		const auto ctrl_first = to_ctrl_i256(first);
+		const auto ctrl_second = to_ctrl_i256(second);
+		const auto shift = static_cast<int>(i % 128);
+		cjm_assert(first + second == wrap(ctrl_first + ctrl_second));
+		cjm_assert(first - second == wrap(ctrl_first - ctrl_second));
+		cjm_assert(first * second == wrap(ctrl_first * ctrl_second));
+		cjm_assert(first / second == wrap(ctrl_first / ctrl_second));
+		cjm_assert(first % second == wrap(ctrl_first % ctrl_second));
+		cjm_assert((first >> shift) == wrap(ctrl_first >= 0 ? ctrl_first >> shift : -((-ctrl_first - 1) >> shift) - 1));
+		cjm_assert((first < second) == (ctrl_first < ctrl_second) && (first == second) == (ctrl_first == ctrl_second));
+		cjm_assert(cjm::numerics::checked_add(first, second).has_value() == fits(ctrl_first + ctrl_second));
+		cjm_assert(cjm::numerics::checked_sub(first, second).has_value() == fits(ctrl_first - ctrl_second));
+		cjm_assert(cjm::numerics::checked_mul(first, second).has_value() == fits(ctrl_first * ctrl_second));
+		cjm_assert(cjm::numerics::saturating_mul(first, second) == wrap(std::clamp(ctrl_first * ctrl_second, ctrl_min, ctrl_max)));
+
+		if (i % 64 == 0)
+		{
+			auto stream = cjm::string::make_throwing_sstream<char>();
+			stream << first;
+			cjm_assert(stream.str() == ctrl_first.str());
+			cjm_assert(int128::make_from_string(stream.str()) == first);
+		}
+	}
+}
+
+void cjm::uint128_tests::execute_multi_limb_dispatch_test(std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	namespace multi_limb = cjm::numerics::multi_limb;
+	namespace internal = cjm::numerics::internal;
+	using ctrl_int_t = boost::multiprecision::cpp_int;
+	using limb_vec_t = std::vector<std::uint64_t>;
+
+	const auto& features = cjm::numerics::detected_cpu_features();
+	cout << std::boolalpha << "ssse3: " << features.ssse3 << "; avx2: " << features.avx2 << "; bmi2: " << features.bmi2
+		<< "; adx: " << features.adx << "; lzcnt: " << features.lzcnt << std::noboolalpha << newl;
+	cout << "multi-limb kernel in use: [" << multi_limb::kernel_name() << "]." << newl;
+
+	auto to_ctrl_limbs = [](const limb_vec_t& limbs) -> ctrl_int_t
+	{
+		//import_bits wants the most significant limb first; shifting and or-ing a limb at a time
+		//trips gcc's -Wmaybe-uninitialized inside boost at -O3
+		auto ret = ctrl_int_t{ 0 };
+		boost::multiprecision::import_bits(ret, limbs.rbegin(), limbs.rend(), std::numeric_limits<std::uint64_t>::digits);
+		return ret;
+	};
+	auto random_limbs = [](generator::rgen& gen, size_t count) -> limb_vec_t
+	{
+		auto ret = limb_vec_t(count);
+		for (auto& limb : ret)
+		{
+			const auto r = generator::create_random_in_range<uint128_t>(gen);
+			//mix in saturated limbs so carries propagate a long way
+			limb = (r.low_part() % 4 == 0) ? std::numeric_limits<std::uint64_t>::max() : r.high_part();
+		}
+		return ret;
+	};
+
+	auto gen = generator::rgen{};
+	for (size_t i = 0; i < 2'000; ++i)
+	{
+		const size_t count = 1 + i % 17;
+		const auto first = random_limbs(gen, count);
+		const auto second = random_limbs(gen, count);
+		const auto ctrl_first = to_ctrl_limbs(first);
+		const auto ctrl_second = to_ctrl_limbs(second);
+		const auto modulus = ctrl_int_t{ 1 } << (64 * count);
+		const unsigned char carry_in = static_cast<unsigned char>(i % 2);
+
+		auto sum = limb_vec_t(count);
+		const auto carry = multi_limb::add(first, second, sum, carry_in);
+		const auto ctrl_sum = ctrl_first + ctrl_second + carry_in;
+		cjm_assert(to_ctrl_limbs(sum) == ctrl_int_t{ ctrl_sum % modulus });
+		cjm_assert(carry == (ctrl_sum >= modulus ? 1 : 0));
+
+		auto difference = limb_vec_t(count);
+		const auto borrow = multi_limb::sub(first, second, difference, carry_in);
+		const auto ctrl_subtrahend = ctrl_second + carry_in;
+		cjm_assert(borrow == (ctrl_first < ctrl_subtrahend ? 1 : 0));
+		cjm_assert(to_ctrl_limbs(difference) == ctrl_int_t{ (ctrl_first + modulus - ctrl_subtrahend) % modulus });
+
+		auto product = limb_vec_t(2 * count);
+		multi_limb::multiply(first, second, product);
+		cjm_assert(to_ctrl_limbs(product) == ctrl_int_t{ ctrl_first * ctrl_second });
+
+		auto accumulator = second;
+		const auto top = multi_limb::multiply_add_u64(accumulator, first, first.back());
+		const auto ctrl_accumulated = ctrl_second + ctrl_first * first.back();
+		cjm_assert(to_ctrl_limbs(accumulator) == ctrl_int_t{ ctrl_accumulated % modulus });
+		cjm_assert(ctrl_int_t{ top } == ctrl_int_t{ ctrl_accumulated >> (64 * count) });
+
+		//whichever kernel was selected, it must agree with the portable one
+		const auto& portable = internal::portable_multi_limb_kernels;
+		auto portable_sum = limb_vec_t(count);
+		cjm_assert(portable.add(first.data(), second.data(), portable_sum.data(), count, carry_in) == carry);
+		cjm_assert(portable_sum == sum);
+		auto portable_accumulator = second;
+		cjm_assert(portable.multiply_add_u64(portable_accumulator.data(), first.data(), count, first.back()) == top);
+		cjm_assert(portable_accumulator == accumulator);
+	}
+	cout << "All multi-limb dispatch tests PASSED." << newl;
+}
+
+void cjm::uint128_tests::execute_atomic_uint128_test(std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::atomic_uint128;
+	using namespace cjm::numerics::uint128_literals;
+	static_assert(alignof(std::atomic<uint128_t>) == alignof(std::uint64_t) * 2);
+	static_assert(std::is_base_of_v<atomic_uint128, std::atomic<uint128_t>>);
+
+	cout << "std::atomic<uint128> is_always_lock_free: " << std::boolalpha
+		<< std::atomic<uint128_t>::is_always_lock_free << std::noboolalpha << newl;
+
+	auto value = std::atomic<uint128_t>{ 0xffff'ffff'ffff'ffff_u128 };
+	cjm_assert(value.load() == 0xffff'ffff'ffff'ffff_u128);
+	cjm_assert(++value == 0x1'0000'0000'0000'0000_u128);
+	cjm_assert(value-- == 0x1'0000'0000'0000'0000_u128);
+	cjm_assert(value == 0xffff'ffff'ffff'ffff_u128);
+	auto expected = 5_u128;
+	cjm_assert(!value.compare_exchange_strong(expected, 7_u128) && expected == 0xffff'ffff'ffff'ffff_u128);
+	cjm_assert(value.compare_exchange_strong(expected, 7_u128, std::memory_order_acq_rel, std::memory_order_acquire));
+	cjm_assert(value.exchange(std::numeric_limits<uint128_t>::max()) == 7_u128);
+	cjm_assert(value.fetch_add(2) == std::numeric_limits<uint128_t>::max() && value.load() == 1);
+	cjm_assert(value.fetch_sub(2) == 1 && value.load() == std::numeric_limits<uint128_t>::max());
+	value = 0xf0f0_u128;
+	cjm_assert((value &= 0xff00_u128) == 0xf000_u128);
+	cjm_assert((value |= 0x0f_u128) == 0xf00f_u128);
+	cjm_assert((value ^= 0xffff_u128) == 0x0ff0_u128);
+	value.store(0, std::memory_order_release);
+	cjm_assert(value.load(std::memory_order_acquire) == 0);
+
+	//contend on one counter (carrying into the high limb each time) and one tagged value
+	constexpr size_t num_threads = 4;
+	constexpr size_t iterations = 50'000;
+	constexpr auto increment = 0x1'0000'0000'0000'0001_u128;
+	auto counter = atomic_uint128{};
+	auto tagged = atomic_uint128{};
+	{
+		auto threads = std::vector<std::thread>{};
+		for (size_t t = 0; t < num_threads; ++t)
+		{
+			threads.emplace_back([&]() -> void
+			{
+				for (size_t i = 0; i < iterations; ++i)
+				{
+					counter.fetch_add(increment, std::memory_order_relaxed);
+					auto current = tagged.load(std::memory_order_relaxed);
+					while (!tagged.compare_exchange_weak(current,
+						uint128_t::make_uint128(current.high_part() + 1, current.low_part() ^ i)))
+					{
+					}
+				}
+			});
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+	}
+	cjm_assert(counter.load() == increment * (num_threads * iterations));
+	cjm_assert(tagged.load().high_part() == num_threads * iterations);
+	cout << "All atomic_uint128 tests PASSED." << newl;
+}
+
+void cjm::uint128_tests::execute_uint128_column_test(std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::uint128_column;
+	namespace internal = cjm::numerics::internal;
+	cout << "uint128_column kernels in use: [" << uint128_column::kernel_name() << "]." << newl;
+
+	auto gen = generator::rgen{};
+	for (size_t count : { size_t{ 0 }, size_t{ 1 }, size_t{ 3 }, size_t{ 4 }, size_t{ 5 }, size_t{ 17 }, size_t{ 1'001 } })
+	{
+		auto first = std::vector<uint128_t>(count);
+		auto second = std::vector<uint128_t>(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			first[i] = generator::create_random_in_range<uint128_t>(gen);
+			//equal elements and equal high limbs exercise the tie-breaking paths
+			second[i] = i % 3 == 0 ? first[i] : (i % 3 == 1
+				? uint128_t::make_uint128(first[i].high_part(), generator::create_random_in_range<uint128_t>(gen).low_part())
+				: generator::create_random_in_range<uint128_t>(gen));
+		}
+		const auto first_column = uint128_column{ std::span<const uint128_t>{ first } };
+		const auto second_column = uint128_column{ std::span<const uint128_t>{ second } };
+		cjm_assert(first_column.size() == count && first_column.to_vector() == first);
+		cjm_assert(count == 0 || reinterpret_cast<std::uintptr_t>(first_column.low_parts().data()) % internal::cache_line_size == 0);
+
+		const auto sum = first_column + second_column;
+		const auto difference = first_column - second_column;
+		const auto bitwise = (first_column & second_column) | (first_column ^ second_column);
+		const auto minimum = uint128_column::min(first_column, second_column);
+		const auto maximum = uint128_column::max(first_column, second_column);
+		const auto order = uint128_column::compare(first_column, second_column);
+		for (size_t i = 0; i < count; ++i)
+		{
+			cjm_assert(sum[i] == first[i] + second[i]);
+			cjm_assert(difference[i] == first[i] - second[i]);
+			cjm_assert(bitwise[i] == ((first[i] & second[i]) | (first[i] ^ second[i])));
+			cjm_assert(minimum[i] == std::min(first[i], second[i]));
+			cjm_assert(maximum[i] == std::max(first[i], second[i]));
+			cjm_assert(order[i] == (first[i] < second[i] ? -1 : (first[i] == second[i] ? 0 : 1)));
+		}
+		for (int shift : { 0, 1, 63, 64, 65, 127 })
+		{
+			const auto left = first_column << shift;
+			const auto right = first_column >> shift;
+			for (size_t i = 0; i < count; ++i)
+			{
+				cjm_assert(left[i] == first[i] << shift);
+				cjm_assert(right[i] == first[i] >> shift);
+			}
+		}
+		auto round_trip = std::vector<uint128_t>(count);
+		(sum - second_column).copy_to(round_trip);
+		cjm_assert(round_trip == first);
+	}
+
+	auto mismatched = uint128_column(3, 1);
+	bool threw = false;
+	try
+	{
+		mismatched += uint128_column(2);
+	}
+	catch (const std::invalid_argument&)
+	{
+		threw = true;
+	}
+	cjm_assert(threw && mismatched == (uint128_column{ 1, 1, 1 }));
+	cout << "All uint128_column tests PASSED." << newl;
+}
+
+void cjm::uint128_tests::execute_uint128_hash_test(std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using namespace cjm::numerics::uint128_literals;
+	constexpr auto sample = 0x1234'5678'9abc'def0'1122'3344'5566'7788_u128;
+	constexpr size_t compile_time_hash = std::hash<uint128_t>{}(sample);
+	static_assert(compile_time_hash != cjm::numerics::legacy_uint128_hash{}(sample));
+
+	auto gen = generator::rgen{};
+	auto values = std::vector<uint128_t>(1'000);
+	for (auto& value : values)
+	{
+		value = generator::create_random_in_range<uint128_t>(gen);
+	}
+	values[0] = sample;
+	auto hashes = std::vector<size_t>(values.size());
+	cjm::numerics::hash_batch(values, hashes);
+	cjm_assert(hashes[0] == compile_time_hash);
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		cjm_assert(hashes[i] == std::hash<uint128_t>{}(values[i]));
+		cjm_assert(cjm::numerics::legacy_uint128_hash{}(values[i]) == values[i].legacy_hash_code());
+	}
+
+	//keys that differ only in their high bits, e.g. sequential ids shifted left, must still spread
+	//over the buckets: the legacy hash maps every one of these to the same value
+	constexpr size_t num_buckets = 1'024;
+	constexpr size_t num_keys = 64 * num_buckets;
+	for (int shift : { 0, 64, 100 })
+	{
+		auto bucket_counts = std::vector<size_t>(num_buckets);
+		for (size_t i = 0; i < num_keys; ++i)
+		{
+			++bucket_counts[std::hash<uint128_t>{}(uint128_t{ i } << shift) % num_buckets];
+		}
+		const auto [fewest, most] = std::minmax_element(bucket_counts.cbegin(), bucket_counts.cend());
+		cout << "shift " << shift << ": bucket loads between " << *fewest << " and " << *most << " (mean 64)." << newl;
+		cjm_assert(*fewest > 16 && *most < 128);
+	}
+	//uint256 and uint512 fold their 128-bit chunks through the same mixer
+	auto check_wide_spread = [&]<typename Wide>(std::type_identity<Wide>, int shift) -> void
+	{
+		auto bucket_counts = std::vector<size_t>(num_buckets);
+		for (size_t i = 0; i < num_keys; ++i)
+		{
+			++bucket_counts[std::hash<Wide>{}(Wide{ i } << shift) % num_buckets];
+		}
+		const auto [fewest, most] = std::minmax_element(bucket_counts.cbegin(), bucket_counts.cend());
+		cjm_assert(*fewest > 16 && *most < 128);
+	};
+	for (int shift : { 0, 64, 128, 240 })
+	{
+		check_wide_spread(std::type_identity<cjm::numerics::uint256>{}, shift);
+	}
+	for (int shift : { 0, 192, 320, 496 })
+	{
+		check_wide_spread(std::type_identity<cjm::numerics::uint512>{}, shift);
+	}
+	auto legacy_set = std::unordered_set<uint128_t, cjm::numerics::legacy_uint128_hash>{ values.cbegin(), values.cend() };
+	cjm_assert(legacy_set.size() == values.size() && legacy_set.contains(sample));
+	cout << "All uint128 hash tests PASSED." << newl;
+}
+
+void cjm::uint128_tests::execute_uint128_flat_map_test(std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::uint128_flat_map;
+	using cjm::numerics::uint128_flat_set;
+	using string_map_t = uint128_flat_map<std::string>;
+	static_assert(std::is_same_v<decltype(std::declval<string_map_t::const_iterator>().value()), const std::string&>);
+	static_assert(std::is_same_v<decltype(std::declval<string_map_t::iterator>().value()), std::string&>);
+	static_assert(std::is_same_v<decltype(std::as_const(std::declval<string_map_t&>()).begin().value()), const std::string&>);
+
+	//random operations on a small key space (so inserts, hits, erasures and tombstones all
+	//happen often), checked against std::unordered_map
+	auto gen = generator::rgen{};
+	auto map = uint128_flat_map<std::string>{};
+	auto control = std::unordered_map<uint128_t, std::string>{};
+	for (size_t step = 0; step < 200'000; ++step)
+	{
+		const auto random = generator::create_random_in_range<uint128_t>(gen);
+		//keys that differ only in their high limb, as well as in their low limb
+		const auto key = uint128_t::make_uint128(random.high_part() % 64, random.low_part() % 512) << (step % 3 == 0 ? 64 : 0);
+		switch (step % 5)
+		{
+		case 0:
+		case 1:
+			cjm_assert(map.insert(key, std::to_string(step)).second == control.emplace(key, std::to_string(step)).second);
+			break;
+		case 2:
+			cjm_assert(map.erase(key) == control.erase(key));
+			break;
+		case 3:
+			map[key] += "x";
+			control[key] += "x";
+			break;
+		default:
+		{
+			const auto it = map.find(key);
+			const auto control_it = control.find(key);
+			cjm_assert((it == map.end()) == (control_it == control.end()));
+			cjm_assert(it == map.end() || it.value() == control_it->second);
+			break;
+		}
+		}
+		cjm_assert(map.size() == control.size());
+	}
+	size_t visited = 0;
+	for (const auto [key, value] : std::as_const(map))
+	{
+		++visited;
+		cjm_assert(control.at(key) == value);
+	}
+	cjm_assert(visited == control.size() && map.load_factor() <= 0.875);
+
+	auto copy = map;
+	for (auto it = copy.begin(); it != copy.end();)
+	{
+		it = it.key().low_part() % 2 == 1 ? copy.erase(it) : std::next(it);
+	}
+	for (const auto& [key, value] : control)
+	{
+		cjm_assert(map.at(key) == value);
+		cjm_assert(copy.contains(key) == (key.low_part() % 2 == 0));
+	}
+	const auto moved = std::move(copy);
+	cjm_assert(copy.empty() && copy.begin() == copy.end());
+	bool threw = false;
+	try
+	{
+		[[maybe_unused]] const auto& value = moved.at(uint128_t{ 1 });
+	}
+	catch (const std::out_of_range&)
+	{
+		threw = true;
+	}
+	cjm_assert(threw);
+
+	//bulk insertion, repeated keys keeping their first value
+	auto keys = std::vector<uint128_t>{};
+	for (size_t i = 0; i < 10'000; ++i)
+	{
+		keys.push_back(uint128_t{ i } << 64);
+	}
+	keys.push_back(keys[5]);
+	auto values = std::vector<size_t>(keys.size());
+	std::iota(values.begin(), values.end(), size_t{ 0 });
+	auto set = uint128_flat_set{};
+	set.insert(keys);
+	auto bulk = uint128_flat_map<size_t>{};
+	bulk.insert(keys, values);
+	cjm_assert(set.size() == 10'000 && bulk.size() == 10'000 && bulk.at(keys[5]) == 5);
+	cjm_assert(std::all_of(set.cbegin(), set.cend(), [](const uint128_t& key) { return key.low_part() == 0; }));
+	cjm_assert(bulk.insert_or_assign(keys[5], size_t{ 42 }).second == false && bulk.at(keys[5]) == 42);
+	set.clear();
+	cjm_assert(set.empty() && !set.contains(keys[0]) && set.slot_count() > 0);
+	cout << "All uint128_flat_map tests PASSED." << newl;
+}
+
+void cjm::uint128_tests::execute_modular_context_test(std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using cjm::numerics::montgomery_context;
+	using cjm::numerics::barrett_context;
+	using big_int = boost::multiprecision::cpp_int;
+	using namespace cjm::numerics::uint128_literals;
+
+	//2^127 - 1 is prime: Fermat's little theorem must hold at compile time in both representations
+	constexpr auto mersenne_127 = (1_u128 << 127) - 1;
+	constexpr auto compile_time_mont = montgomery_context<uint128_t>{ mersenne_127 };
+	static_assert(compile_time_mont.from_mont(compile_time_mont.pow(compile_time_mont.to_mont(3), mersenne_127 - 1)) == 1);
+	constexpr auto compile_time_barrett = barrett_context<uint128_t>{ mersenne_127 };
+	static_assert(compile_time_barrett.pow(3, mersenne_127 - 1) == 1);
+	static_assert(!montgomery_context<uint128_t>::try_make(0x1'0000'0000_u128).has_value());
+	static_assert(!barrett_context<uint128_t>::try_make(1).has_value());
+
+	auto gen = generator::rgen{};
+	constexpr size_t num_moduli = 2'000;
+	for (size_t i = 0; i < num_moduli; ++i)
+	{
+		auto modulus = generator::create_random_in_range<uint128_t>(gen);
+		//alternate full width moduli with short ones
+		if ((i & 1) != 0)
+		{
+			modulus >>= static_cast<int>(modulus.low_part() % 125);
+		}
+		modulus = modulus < 3 ? 3 : modulus;
+		const auto lhs = generator::create_random_in_range<uint128_t>(gen) % modulus;
+		const auto rhs = generator::create_random_in_range<uint128_t>(gen) % modulus;
+		const auto exponent = generator::create_random_in_range<uint128_t>(gen);
+		const auto unreduced = generator::create_random_in_range<uint128_t>(gen);
+		const auto big_modulus = big_int{ to_ctrl(modulus) };
+		const auto expected_product = to_test(ctrl_uint128_t{ big_int{ to_ctrl(lhs) } * to_ctrl(rhs) % big_modulus });
+		const auto expected_sum = to_test(ctrl_uint128_t{ (big_int{ to_ctrl(lhs) } + to_ctrl(rhs)) % big_modulus });
+		const auto expected_difference = to_test(ctrl_uint128_t{ (big_int{ to_ctrl(lhs) } + big_modulus - to_ctrl(rhs)) % big_modulus });
+		const auto expected_power = to_test(ctrl_uint128_t{ boost::multiprecision::powm(big_int{ to_ctrl(lhs) }, big_int{ to_ctrl(exponent) }, big_modulus) });
+
+		const auto barrett = barrett_context<uint128_t>{ modulus };
+		cjm_assert(barrett.modulus() == modulus);
+		cjm_assert(barrett.mul(lhs, rhs) == expected_product);
+		cjm_assert(barrett.add(lhs, rhs) == expected_sum);
+		cjm_assert(barrett.sub(lhs, rhs) == expected_difference);
+		cjm_assert(barrett.reduce(unreduced) == unreduced % modulus);
+		cjm_assert(barrett.pow(lhs, exponent) == expected_power);
+
+		if ((modulus & 1) == 0)
+		{
+			cjm_assert(!montgomery_context<uint128_t>::try_make(modulus).has_value());
+			continue;
+		}
+		const auto montgomery = montgomery_context<uint128_t>{ modulus };
+		const auto lhs_mont = montgomery.to_mont(lhs);
+		const auto rhs_mont = montgomery.to_mont(rhs);
+		cjm_assert(montgomery.from_mont(montgomery.one()) == 1);
+		cjm_assert(montgomery.from_mont(montgomery.mul(lhs_mont, rhs_mont)) == expected_product);
+		cjm_assert(montgomery.from_mont(montgomery.add(lhs_mont, rhs_mont)) == expected_sum);
+		cjm_assert(montgomery.from_mont(montgomery.sub(lhs_mont, rhs_mont)) == expected_difference);
+		cjm_assert(montgomery.from_mont(montgomery.to_mont(unreduced)) == unreduced % modulus);
+		cjm_assert(montgomery.from_mont(montgomery.pow(lhs_mont, exponent)) == expected_power);
+	}
+	bool threw = false;
+	try
+	{
+		[[maybe_unused]] const auto bad = montgomery_context<uint128_t>{ 0x10_u128 };
+	}
+	catch (const std::domain_error&)
+	{
+		threw = true;
+	}
+	cjm_assert(threw);
+	cout << "All modular context tests PASSED." << newl;
+}
+
+void cjm::uint128_tests::execute_number_theory_test(std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using big_int = boost::multiprecision::cpp_int;
+	using namespace cjm::numerics::uint128_literals;
+	namespace nt = cjm::numerics;
+
+	constexpr auto mersenne_127 = (1_u128 << 127) - 1;
+	static_assert(nt::is_prime(mersenne_127) && !nt::is_prime(mersenne_127 - 2));
+	static_assert(nt::gcd(48, 180) == 12 && nt::lcm(4, 6) == 12);
+	static_assert(*nt::mod_inverse(3, 7) == 5 && !nt::mod_inverse(4, 8).has_value());
+	static_assert(nt::pow_mod(3, mersenne_127 - 1, mersenne_127) == 1);
+	//2^128 - 159 is the largest prime that fits
+	cjm_assert(nt::is_prime(std::numeric_limits<uint128_t>::max() - 158));
+	//each bound is itself a strong pseudoprime to every base before it
+	for (const auto bound : nt::internal::strong_pseudoprime_bounds)
+	{
+		cjm_assert(!nt::is_prime(bound));
+	}
+	//the first strong Lucas pseudoprimes (Selfridge parameters) with no prime factor below 50
+	for (const uint128_t pseudoprime : { 5'459, 5'777, 10'877, 16'109, 18'971, 22'499, 24'569, 25'199, 40'309, 58'519 })
+	{
+		cjm_assert(!nt::is_prime(pseudoprime));
+		cjm_assert(nt::internal::is_strong_lucas_probable_prime(nt::montgomery_context<uint128_t>{ pseudoprime }));
+	}
+
+	auto control_engine = std::mt19937_64{ 0x5eed };
+	for (std::uint64_t small = 0; small < 100'000; ++small)
+	{
+		cjm_assert(nt::is_prime(small) == (small > 1 && boost::multiprecision::miller_rabin_test(big_int{ small }, 25, control_engine)));
+	}
+
+	auto gen = generator::rgen{};
+	size_t primes_found = 0;
+	constexpr size_t num_trials = 5'000;
+	for (size_t i = 0; i < num_trials; ++i)
+	{
+		//odd candidates of every size, large ones to exercise the Lucas test
+		const auto candidate = (generator::create_random_in_range<uint128_t>(gen) >> static_cast<int>(i % 100)) | 1;
+		const bool prime = nt::is_prime(candidate);
+		primes_found += prime ? 1 : 0;
+		cjm_assert(prime == boost::multiprecision::miller_rabin_test(big_int{ to_ctrl(candidate) }, 25, control_engine));
+
+		const auto first = generator::create_random_in_range<uint128_t>(gen) >> static_cast<int>(i % 128);
+		const auto second = generator::create_random_in_range<uint128_t>(gen) >> static_cast<int>((i * 7) % 128);
+		const auto big_first = big_int{ to_ctrl(first) };
+		const auto big_second = big_int{ to_ctrl(second) };
+		const auto big_candidate = big_int{ to_ctrl(candidate) };
+		cjm_assert(big_int{ to_ctrl(nt::gcd(first, second)) } == boost::multiprecision::gcd(big_first, big_second));
+		const auto big_lcm = boost::multiprecision::lcm(big_first, big_second);
+		if (big_lcm <= big_int{ to_ctrl(std::numeric_limits<uint128_t>::max()) })
+		{
+			cjm_assert(big_int{ to_ctrl(nt::lcm(first, second)) } == big_lcm);
+		}
+		const auto inverse = nt::mod_inverse(first, candidate);
+		if (candidate != 1 && boost::multiprecision::gcd(big_first, big_candidate) == 1)
+		{
+			cjm_assert(inverse.has_value() && *inverse < candidate && big_first * to_ctrl(*inverse) % big_candidate == 1);
+		}
+		else
+		{
+			cjm_assert(!inverse.has_value() || candidate == 1);
+		}
+		//alternate odd and even moduli
+		const auto modulus = (i & 1) != 0 ? candidate : candidate + 1;
+		if (modulus != 0)
+		{
+			cjm_assert(big_int{ to_ctrl(nt::pow_mod(first, second, modulus)) } ==
+				boost::multiprecision::powm(big_first, big_second, big_int{ to_ctrl(modulus) }));
+		}
+	}
+	cjm_assert(primes_found > 0);
+	cout << "Found " << primes_found << " primes among " << num_trials << " odd candidates." << newl;
+	cout << "All number theory tests PASSED." << newl;
+}
+
+void cjm::uint128_tests::execute_bit_functions_test(std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
+{
+	using namespace cjm::numerics::uint128_literals;
+	namespace cn = cjm::numerics;
+	constexpr int digits = std::numeric_limits<uint128_t>::digits;
+
+	static_assert(cn::countl_zero(uint128_t{}) == digits && cn::countr_zero(uint128_t{}) == digits);
+	static_assert(cn::popcount(std::numeric_limits<uint128_t>::max()) == digits && cn::countl_one(std::numeric_limits<uint128_t>::max()) == digits);
+	static_assert(cn::bit_width(uint128_t{}) == 0 && cn::bit_floor(uint128_t{}) == 0 && cn::bit_ceil(uint128_t{}) == 1);
+	static_assert(cn::bit_ceil(5_u128) == 8 && cn::bit_floor((1_u128 << 100) | 7) == 1_u128 << 100);
+	static_assert(cn::byteswap(0x0102'0304'0506'0708'090a'0b0c'0d0e'0f10_u128) == 0x100f'0e0d'0c0b'0a09'0807'0605'0403'0201_u128);
+	static_assert(cn::rotl(1_u128 << 127, 1) == 1 && cn::rotr(1_u128, -1) == 2 && cn::rotl(3_u128, 2 * digits + 64) == 3_u128 << 64);
+
+	auto bit_at = [](uint128_t value, int bit) -> bool { return ((value >> bit) & 1) != 0; };
+	auto gen = generator::rgen{};
+	for (int i = 0; i < 10'000; ++i)
+	{
+		auto value = generator::create_random_in_range<uint128_t>(gen);
+		//mix in values with long runs of zeroes or ones at either end
+		switch (i % 5)
+		{
+		case 1: value >>= i % digits; break;
+		case 2: value <<= i % digits; break;
+		case 3: value = ~(value >> (i % digits)); break;
+		case 4: value = uint128_t{ 1 } << (i % digits); break;
+		default: break;
+		}
+		int set_bits = 0;
+		int leading_zeroes = 0, trailing_zeroes = 0, leading_ones = 0, trailing_ones = 0;
+		for (int bit = 0; bit < digits; ++bit)
+		{
+			set_bits += bit_at(value, bit) ? 1 : 0;
+		}
+		while (leading_zeroes < digits && !bit_at(value, digits - 1 - leading_zeroes)) ++leading_zeroes;
+		while (trailing_zeroes < digits && !bit_at(value, trailing_zeroes)) ++trailing_zeroes;
+		while (leading_ones < digits && bit_at(value, digits - 1 - leading_ones)) ++leading_ones;
+		while (trailing_ones < digits && bit_at(value, trailing_ones)) ++trailing_ones;
+		cjm_assert(cn::popcount(value) == set_bits);
+		cjm_assert(cn::countl_zero(value) == leading_zeroes && cn::countr_zero(value) == trailing_zeroes);
+		cjm_assert(cn::countl_one(value) == leading_ones && cn::countr_one(value) == trailing_ones);
+		cjm_assert(cn::bit_width(value) == digits - leading_zeroes);
+		cjm_assert(cn::has_single_bit(value) == (set_bits == 1));
+		const auto floor = cn::bit_floor(value);
+		cjm_assert(value == 0 ? floor == 0 : cn::has_single_bit(floor) && floor <= value && (floor << 1 > value || floor << 1 == 0));
+		if (value <= uint128_t{ 1 } << (digits - 1))
+		{
+			const auto ceiling = cn::bit_ceil(value);
+			cjm_assert(cn::has_single_bit(ceiling) && ceiling >= value && (ceiling >> 1 < value || ceiling == 1));
+		}
+		const int count = static_cast<int>(value.low_part() % 600) - 300;
+		const auto left = cn::rotl(value, count);
+		const auto right = cn::rotr(value, count);
+		const int shift = ((count % digits) + digits) % digits;
+		for (int bit = 0; bit < digits; ++bit)
+		{
+			cjm_assert(bit_at(left, (bit + shift) % digits) == bit_at(value, bit));
+		}
+		cjm_assert(cn::rotl(right, count) == value && cn::rotr(value, -count) == left);
+		const auto swapped = cn::byteswap(value);
+		for (int byte = 0; byte < 16; ++byte)
+		{
+			cjm_assert(((swapped >> (8 * byte)) & 0xff) == ((value >> (8 * (15 - byte))) & 0xff));
+		}
+	}
+	cout << "All uint128 bit function tests PASSED." << newl;
+}
+
 void cjm::uint128_tests::execute_issue27_bug_test([[maybe_unused]] std::basic_ostream<char>& cout, [[maybe_unused]] std::basic_ostream<char>& cerr)
 {
 	constexpr auto expected_value = 0xc0de'd00d'ea75'dead'beef'600d'f00d_u128;
@@ -5490,6 +7268,9 @@ std::basic_ostream<char>& cjm::uint128_tests::operator<<(std::basic_ostream<char
 	case lit_type::Zero:
 		os << "Zero"sv;
 		break;
+	case lit_type::Binary:
+		os << "Binary"sv;
+		break;
 	}
 	return os;
 }
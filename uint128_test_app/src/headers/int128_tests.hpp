@@ -21,6 +21,15 @@
 #include <iostream>
 #include <cjm/numerics/numerics.hpp>
 #include <cjm/numerics/uint128.hpp>
+#include <cjm/numerics/uint128_divider.hpp>
+#include <cjm/numerics/fixed_uint.hpp>
+#include <cjm/numerics/int128.hpp>
+#include <cjm/numerics/cpu_dispatch.hpp>
+#include <cjm/numerics/atomic_uint128.hpp>
+#include <cjm/numerics/uint128_column.hpp>
+#include <cjm/numerics/uint128_flat_map.hpp>
+#include <cjm/numerics/uint128_modular.hpp>
+#include <cjm/numerics/uint128_number_theory.hpp>
 #include <cjm/numerics/cjm_numeric_concepts.hpp>
 #include <cjm/string/cjm_string.hpp>
 #include "testing.hpp"
@@ -38,10 +47,12 @@
 #include <stdexcept>
 #include <utility>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/miller_rabin.hpp>
 #include <concepts>
 #include <cstdint>
 #include <random>
 #include <algorithm>
+#include <numeric>
 #include <vector>
 #include<functional>
 #include <memory>
@@ -51,6 +62,7 @@
 #include <filesystem>
 #include <tuple>
 #include <span>
+#include <unordered_map>
 #include <unordered_set>
 #include <cjm/string/istream_utils.hpp>
 #include "int128_test_switches.hpp"
@@ -233,6 +245,31 @@ namespace cjm::uint128_tests
 
 	void execute_umult_spec_tests(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
 	void execute_uintcontainer_adc_tests(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_to_chars_from_chars_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_decimal_formatting_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_hex_formatting_parsing_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_decimal_parsing_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_try_parse_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_format_spec_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_format_decimal_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_stream_extraction_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_radix_conversion_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_limb_division_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_divider_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_div_by_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_batch_div_mod_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_div_mod_u64_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_wide_multiply_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_fixed_uint_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_int128_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_multi_limb_dispatch_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_atomic_uint128_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_uint128_column_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_uint128_hash_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_uint128_flat_map_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_modular_context_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_number_theory_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
+	void execute_bit_functions_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
 
 	void execute_issue27_bug_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
 	void execute_literal_test(std::basic_ostream<char>& cout, std::basic_ostream<char>& cerr);
@@ -584,6 +621,31 @@ namespace cjm::uint128_tests
 
 		std::make_pair<test_func_t, std::string_view>(&execute_umult_spec_tests, "umult_spec_tests"sv),
 		std::make_pair<test_func_t, std::string_view>(&execute_uintcontainer_adc_tests, "uintcontainer_adc_tests"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_to_chars_from_chars_test, "to_chars_from_chars_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_decimal_formatting_test, "decimal_formatting_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_hex_formatting_parsing_test, "hex_formatting_parsing_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_decimal_parsing_test, "decimal_parsing_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_try_parse_test, "try_parse_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_format_spec_test, "format_spec_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_format_decimal_test, "format_decimal_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_stream_extraction_test, "stream_extraction_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_radix_conversion_test, "radix_conversion_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_limb_division_test, "limb_division_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_divider_test, "divider_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_div_by_test, "div_by_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_batch_div_mod_test, "batch_div_mod_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_div_mod_u64_test, "div_mod_u64_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_wide_multiply_test, "wide_multiply_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_fixed_uint_test, "fixed_uint_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_int128_test, "int128_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_multi_limb_dispatch_test, "multi_limb_dispatch_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_atomic_uint128_test, "atomic_uint128_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_uint128_column_test, "uint128_column_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_uint128_hash_test, "uint128_hash_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_uint128_flat_map_test, "uint128_flat_map_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_modular_context_test, "modular_context_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_number_theory_test, "number_theory_test"sv),
+		std::make_pair<test_func_t, std::string_view>(&execute_bit_functions_test, "bit_functions_test"sv),
 	};
 	
 }